@@ -12,7 +12,15 @@
 #           2017-09-22 Wheel Ver:0.1.5 [Heyn] New _crcx.
 #           2020-03-16 Wheel Ver:0.1.6 [Heyn] New hacker16 / hacker32 / hacker64.
 #           2020-04-17 Wheel Ver:1.1   [Heyn] New add CRC24
+#           2022-05-30 Wheel Ver:1.8   [Heyn] New add libscrc.new() incremental objects.
+#           2022-05-31 Wheel Ver:1.8   [Heyn] New add libscrc.combine() ( crc32_combine() for every model ).
+#           2022-06-03 Wheel Ver:1.8   [Heyn] New add libscrc.batch() many frames in one call.
+#           2022-06-09 Wheel Ver:1.8   [Heyn] _crc82 is a C module ( darc82 / hacker82 ).
+#           2022-06-11 Wheel Ver:1.8   [Heyn] New add libscrc.Model( width, poly, init, refin, refout, xorout ).
+#           2022-06-13 Wheel Ver:1.8   [Heyn] New add libscrc.cpu_features() / kernel_for(), LIBSCRC_KERNEL caps the kernels.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] _pool first, the worker pool the other modules import at their init.
 
+from . import _pool
 from ._crcx  import *
 from ._canx  import *
 from ._crc8  import *
@@ -21,3 +29,80 @@ from ._crc24 import *
 from ._crc32 import *
 from ._crc64 import *
 from ._crc82 import *
+from ._model import Model
+
+from . import _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64, _crc82
+
+from array import array
+import os
+import warnings
+
+# The kernels from the plain byte table up, LIBSCRC_KERNEL=<kernel> caps the dispatch ( read at import ).
+KERNELS = ( 'scalar', 'slicing', 'sse4.2', 'pclmul', 'avx2', 'avx512' )
+
+if os.environ.get( 'LIBSCRC_KERNEL', '' ) not in ( '', ) + KERNELS:
+    warnings.warn( 'LIBSCRC_KERNEL={0} is not one of {1}, ignored'.format( os.environ['LIBSCRC_KERNEL'], ', '.join( KERNELS ) ) )
+
+
+def new( name, data=None, **kwargs ):
+    """ Incremental (hashlib style) CRC object of a model, name is the one of its function.
+        crc = libscrc.new( 'modbus' )
+        crc.update( b'1234' )
+        crc.update( b'56789' )
+        crc.intdigest() == libscrc.modbus( b'123456789' )
+        hacker8/16/24/32/64/82 take poly, init, xorout, refin and refout: libscrc.new( 'hacker16', poly=0x1021 )
+    """
+    for module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64, _crc82 ):
+        crc = module._new( name, data, **kwargs )
+        if crc is not None:
+            return crc
+    raise ValueError( 'unsupported CRC model {0}'.format( name ) )
+
+
+def combine( name, crc1, crc2, len2, **kwargs ):
+    """ CRC of A + B from crc1 = CRC( A ), crc2 = CRC( B ) and len2 = len( B ), like zlib crc32_combine().
+        Parts hashed apart ( other threads, out of order ) are joined without reading A or B again.
+        libscrc.combine( 'crc32', libscrc.crc32( b'1234' ), libscrc.crc32( b'56789' ), 5 ) == libscrc.crc32( b'123456789' )
+        hacker8/16/24/32/64 take poly, init, xorout, refin and refout, as libscrc.new()
+    """
+    for module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64 ):
+        crc = module._combine( name, crc1, crc2, len2, **kwargs )
+        if crc is not None:
+            return crc
+    raise ValueError( 'unsupported CRC model {0}'.format( name ) )
+
+
+def batch( name, data, offsets=None, **kwargs ):
+    """ CRC of many frames in one call ( one GIL release ), returns an array.array of the results.
+        data is a sequence of bytes-like objects, or one bytes-like object cut by offsets:
+        frame i is data[ offsets[i]:offsets[i + 1] ], len( offsets ) is the number of frames + 1.
+        libscrc.batch( 'modbus', [ b'1234', b'56789' ] ) == array( 'H', [ libscrc.modbus( b'1234' ), libscrc.modbus( b'56789' ) ] )
+        libscrc.batch( 'modbus', b'123456789', [ 0, 4, 9 ] ) is the same.
+        hacker8/16/24/32/64 take poly, init, xorout, refin and refout, as libscrc.new()
+    """
+    for module, typecode in ( ( _crcx, 'H' ), ( _canx, 'I' ), ( _crc8, 'B' ), ( _crc16, 'H' ),
+                              ( _crc24, 'I' ), ( _crc32, 'I' ), ( _crc64, 'Q' ) ):
+        crc = module._batch( name, data, offsets, **kwargs )
+        if crc is not None:
+            return array( typecode, crc )
+    raise ValueError( 'unsupported CRC model {0}'.format( name ) )
+
+
+def cpu_features():
+    """ The CPU features the kernels may use, { 'ssse3' : True, 'sse4.1' : True, ... 'avx512' : False, 'vpclmul' : False }.
+        Detected by CPUID at import, the ones above LIBSCRC_KERNEL=<kernel> are reported False.
+    """
+    return _crc32._cpu_features()
+
+
+def kernel_for( name ):
+    """ The kernel computing the model on this CPU, one of libscrc.KERNELS.
+        libscrc.kernel_for( 'crc32' ) == 'pclmul', libscrc.kernel_for( 'crc32_c' ) == 'sse4.2'
+        hacker8/16/24/32/64/82 are their default models.
+        LIBSCRC_KERNEL=slicing python app.py runs every model with the slicing-by-8 tables ( benchmarks, pinning ).
+    """
+    for module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64, _crc82 ):
+        kernel = module._kernel( name )
+        if kernel is not None:
+            return kernel
+    raise ValueError( 'unsupported CRC model {0}'.format( name ) )
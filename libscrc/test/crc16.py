@@ -11,8 +11,14 @@
 #           2020-04-28 Wheel Ver:1.3   [Heyn] Optimized code.
 #           2020-08-04 Wheel Ver:1.4   [Heyn] New add gradually calculating
 #           2021-06-08 Wheel Ver:1.7   [Heyn] Optimize the code for hacker16
+#           2022-05-30 Wheel Ver:1.8   [Heyn] New add libscrc.new() test code.
+#           2022-06-07 Wheel Ver:1.8   [Heyn] New add internet checksum ( 64-bit sums, RFC 1624 update ) test code.
+#           2022-06-08 Wheel Ver:1.8   [Heyn] New add fletcher8/fletcher16 ( AVX2 blocks, value goes on ) test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] New add one libscrc.new() object updated by many threads test code.
 
+import struct
 import unittest
+import threading
 
 import libscrc
 from libscrc import _crc16
@@ -167,6 +173,93 @@ class TestCRC16( unittest.TestCase ):
         self.do_gradually( _crc16 )
         self.do_basics(   _crc16 )
 
+    def network( self, data ):
+        """ RFC 1071 reference, little-endian words.
+        """
+        data = data + b'\x00' * ( len( data ) & 1 )
+        crc  = sum( struct.unpack( '<%dH' % ( len( data ) // 2 ), data ) )
+        while crc >> 16:
+            crc = ( crc & 0xFFFF ) + ( crc >> 16 )
+        return ~crc & 0xFFFF
+
+    def test_network( self ):
+        """ Test udp/tcp across the 64 bytes blocks, over 128 KB ( a 32-bit sum overflowed ) and the RFC 1624 update.
+        """
+        data = bytes( bytearray( 0xFF if i % 3 else ( i * 7 ) & 0xFF for i in range( 300 * 1024 + 5 ) ) )
+        for i in ( 0, 1, 2, 63, 64, 65, 129, 1000, 128 * 1024 + 1, len( data ) ):
+            self.assertEqual( libscrc.udp( data[:i] ), self.network( data[:i] ) )
+            self.assertEqual( libscrc.tcp( data[1:i] ), self.network( data[1:i] ) )
+        self.assertEqual( libscrc.udp( b'\xFF' * 256 * 1024 ), 0x0000 )
+
+        header = bytearray( b'\x45\x00\x00\x3c\x00\x00\x00\x00\x40\x11\x00\x00\xc0\xa8\x2b\xc3\x08\x08\x08\x08\x11' )
+        crc = libscrc.udp( bytes( header ) )
+        for offset, new in ( ( 8, b'\x3F' ), ( 12, b'\x0a\x00\x00\x01' ), ( 2, b'\xFF\xFF' ), ( 20, b'\x06' ) ):
+            old = bytes( header[offset:offset + len( new )] )
+            header[offset:offset + len( new )] = new
+            crc = libscrc.udp_update( crc, old, new )
+            self.assertEqual( crc, libscrc.udp( bytes( header ) ) )
+            self.assertEqual( libscrc.tcp_update( checksum=crc, old=new, new=new ), crc )
+
+        self.assertRaises( ValueError, libscrc.udp_update, crc, b'\x00\x01', b'\x00' )
+
+    def test_fletcher( self ):
+        """ Test fletcher8/fletcher16 across the 32 bytes blocks and the NMAX ( 5552 ) reductions, one shot and gone on.
+        """
+        data = bytes( bytearray( 0xFF if i % 5 else ( i * 13 ) & 0xFF for i in range( 5552 * 3 + 77 ) ) )
+        sums = [ ( 0, 0 ) ]
+        for c in bytearray( data ):
+            sum1 = ( sums[-1][0] + c ) % 255
+            sums.append( ( sum1, ( sums[-1][1] + sum1 ) % 255 ) )
+
+        for i in ( 0, 1, 31, 32, 33, 5551, 5552, 5553, 5552 * 2 + 31, len( data ) ):
+            self.assertEqual( libscrc.fletcher16( data[:i] ), sums[i][0] | ( sums[i][1] << 8 ) )
+            self.assertEqual( libscrc.fletcher16( data[i:], libscrc.fletcher16( data[:i] ) ), libscrc.fletcher16( data ) )
+            self.assertEqual( libscrc.fletcher8( data[i:], libscrc.fletcher8( data[:i] ) ), libscrc.fletcher8( data ) )
+
+    def test_new( self ):
+        """ Test incremental objects ( libscrc.new ).
+        """
+        data = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 64 * 1024 ) ) )
+
+        crc = libscrc.new( 'modbus' )
+        crc.update( b'1234' )
+        prefix = crc.copy()
+        crc.update( b'56789' )
+        self.assertEqual( crc.intdigest(), 0x4B37 )
+        self.assertEqual( crc.digest(),    b'\x4B\x37' )
+        self.assertEqual( crc.hexdigest(), '4b37' )
+        self.assertEqual( crc.name,        'modbus' )
+        self.assertEqual( crc.digest_size, 2 )
+        prefix.update( b'56780' )
+        self.assertEqual( prefix.intdigest(), libscrc.modbus( b'123456780' ) )
+
+        for name in ( 'modbus', 'xmodem', 'x25', 'crc8', 'crc24', 'crc32', 'ecma182', 'can15', 'epc' ):
+            crc = libscrc.new( name, data[:1000] )
+            crc.update( data[1000:] )
+            self.assertEqual( crc.intdigest(), getattr( libscrc, name )( data ) )
+
+        crc = libscrc.new( 'hacker16', b'1234', poly=0x8005, init=0xFFFF, xorout=0x0000, refin=True, refout=False )
+        crc.update( b'56789' )
+        self.assertEqual( crc.intdigest(), 0xECD2 )
+
+        self.assertRaises( TypeError,  libscrc.new, 'modbus', poly=0x8005 )
+        self.assertRaises( ValueError, libscrc.new, 'unknown' )
+
+    def test_new_threads( self ):
+        """ Test one incremental object updated by many threads, no update() is lost.
+        """
+        data = b'A' * 256 * 1024
+
+        for crc, func in ( ( libscrc.new( 'modbus' ), libscrc.modbus ),
+                           ( libscrc.new( 'darc82' ), libscrc.darc82 ),
+                           ( libscrc.Model( 16, 0x8005, 0xFFFF, True, True, 0x0000 ).new(), libscrc.modbus ) ):
+            workers = [ threading.Thread( target=lambda: [ crc.update( data ) for _ in range( 8 ) ] ) for _ in range( 8 ) ]
+            for worker in workers:
+                worker.start()
+            for worker in workers:
+                worker.join()
+            self.assertEqual( crc.intdigest(), func( data * 64 ) )
+
 
 if __name__ == '__main__':
     unittest.main()
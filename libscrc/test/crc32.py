@@ -10,11 +10,21 @@
 #           2020-04-26 Wheel Ver:1.3   [Heyn] Optimized Code
 #           2020-08-05 Wheel Ver:1.4   [Heyn] New add gradually calculating
 #           2021-06-08 Wheel Ver:1.7   [Heyn] Optimize the code for hacker32
+#           2022-05-09 Wheel Ver:1.8   [Heyn] New add slicing-by-8 test code.
+#           2022-05-16 Wheel Ver:1.8   [Heyn] New add PCLMULQDQ folding test code.
+#           2022-05-18 Wheel Ver:1.8   [Heyn] New add SSE4.2 CRC32C test code.
+#           2022-05-31 Wheel Ver:1.8   [Heyn] New add libscrc.combine() test code.
+#           2022-06-06 Wheel Ver:1.8   [Heyn] New add adler32 ( NMAX blocks, SSSE3/AVX2 ) test code.
+#           2022-06-08 Wheel Ver:1.8   [Heyn] New add fletcher32 ( AVX2 blocks, value goes on ) test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] adler32 of a value with a half >= 65521, as zlib.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] bitwise() is the one of reference.py.
 
+import zlib
 import unittest
 
 import libscrc
 from libscrc import _crc32
+from libscrc.test.reference import bitwise
 
 class TestCRC32( unittest.TestCase ):
     """ Test CRC32 variant.
@@ -92,17 +102,129 @@ class TestCRC32( unittest.TestCase ):
         self.assertEqual( module.hacker32( data=b'123456789', poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=False, refout=True,  reinit=True ), 0x1898913F )
         self.assertEqual( module.hacker32( data=b'123456789', poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=True,  refout=True,  reinit=True ), 0xCBF43926 )
 
+    def do_slicing( self, module ):
+        """ Test slicing-by-8 with the unaligned head and tail bytes.
+        """
+        data = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 1031 ) ) )
+        for i in range( 0, 24 ):
+            self.assertEqual( module.crc32( data[i:] ), zlib.crc32( data[i:] ) & 0xFFFFFFFF )
+            self.assertEqual( module.crc32( data[:i] ), zlib.crc32( data[:i] ) & 0xFFFFFFFF )
+            self.assertEqual( module.crc32( data[i+9:], module.crc32( data[:i+9] ) ), zlib.crc32( data ) & 0xFFFFFFFF )
+
+    def do_clmul( self, module ):
+        """ Test the carry-less multiply folding ( len >= 64 ) against bit by bit.
+        """
+        data = bytes( bytearray( ( i * 131 + 17 ) & 0xFF for i in range( 300 ) ) )
+        for i in ( 63, 64, 65, 79, 80, 127, 128, 129, 191, 255, 256, 300 ):
+            self.assertEqual( module.mpeg2( data[:i] ),   bitwise( data[:i], 32, 0x04C11DB7, 0xFFFFFFFF, False, False, 0x00000000 ) )
+            self.assertEqual( module.crc32_c( data[:i] ), bitwise( data[:i], 32, 0x1EDC6F41, 0xFFFFFFFF, True,  True,  0xFFFFFFFF ) )
+            self.assertEqual( module.cdma( data[:i] ),    bitwise( data[:i], 30, 0x2030B9C7, 0x3FFFFFFF, False, False, 0x3FFFFFFF ) )
+            for refin, refout in ( ( True, True ), ( False, False ), ( True, False ), ( False, True ) ):
+                self.assertEqual( module.hacker32( data[:i], poly=0x814141AB, init=0x12345678, xorout=0x0000FFFF, refin=refin, refout=refout, reinit=True ),
+                                  bitwise( data[:i], 32, 0x814141AB, 0x12345678, refin, refout, 0x0000FFFF ) )
+
+        # hacker32() keeps the last parameters, restore the default model.
+        module.hacker32( b'', poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=True, refout=True, reinit=True )
+
+    def do_crc32c( self, module ):
+        """ Test CRC32C across the 3 x 8192 and 3 x 256 interleaved blocks.
+        """
+        table = []
+        for i in range( 256 ):
+            crc = i
+            for _ in range( 8 ):
+                crc = ( crc >> 1 ) ^ 0x82F63B78 if crc & 1 else crc >> 1
+            table.append( crc )
+
+        data = bytes( bytearray( ( i * 29 + ( i >> 8 ) ) & 0xFF for i in range( 3 * 8192 * 2 + 3 * 256 + 77 ) ) )
+        crc, expected = 0xFFFFFFFF, {}
+        for i, c in enumerate( bytearray( data ) ):
+            crc = ( crc >> 8 ) ^ table[ ( crc ^ c ) & 0xFF ]
+            expected[i + 1] = crc ^ 0xFFFFFFFF
+
+        for i in ( 767, 768, 3 * 256 + 77, 3 * 8192 - 1, 3 * 8192 + 1, len( data ) ):
+            self.assertEqual( module.crc32_c( data[:i] ), expected[i] )
+            self.assertEqual( module.crc32_c( data[5:i], module.crc32_c( data[:5] ) ), expected[i] )
+
+    def do_adler32( self, module ):
+        """ Test adler32 across the 32 bytes blocks and the NMAX ( 5552 ) reductions, as zlib.adler32().
+        """
+        self.assertEqual( module.adler32( b'Wikipedia' ), 0x11E60398 )
+        self.assertEqual( module.adler32( b'' ), 1 )
+        for value in ( 0xFFFFFFFF, 0xFFF1FFF1, 0xFFF0FFF0, 0x0001FFF1 ):
+            self.assertEqual( module.adler32( b'', value ), zlib.adler32( b'', value ) )
+            self.assertEqual( module.adler32( b'a', value ), zlib.adler32( b'a', value ) )
+
+        data = bytes( bytearray( 0xFF if i % 5 else ( i * 13 ) & 0xFF for i in range( 5552 * 3 + 77 ) ) )
+        for i in ( 7, 8, 31, 32, 33, 5551, 5552, 5553, 5552 * 2 + 31, len( data ) ):
+            self.assertEqual( module.adler32( data[:i] ), zlib.adler32( data[:i] ) )
+            self.assertEqual( module.adler32( data[3:i] ), zlib.adler32( data[3:i] ) )
+            self.assertEqual( module.adler32( data[7:i], module.adler32( data[:7] ) ), zlib.adler32( data[:i] ) )
+            self.assertEqual( module.adler32( data[:i], 0xFFF0FFF0 ), zlib.adler32( data[:i], 0xFFF0FFF0 ) )
+
+    def do_fletcher32( self, module ):
+        """ Test fletcher32 ( little-endian words ) across the 32 bytes blocks and the 359 words reductions.
+        """
+        data = bytes( bytearray( 0xFF if i % 5 else ( i * 13 ) & 0xFF for i in range( 5552 * 3 + 77 ) ) )
+        sum1, sum2, expected = 0xFFFF, 0xFFFF, {}
+        for i in range( 0, len( data ) + 2, 2 ):
+            expected[i] = ( sum1 or 0xFFFF ) | ( ( sum2 or 0xFFFF ) << 16 )
+            word = bytearray( data[i:i + 2] + b'\x00\x00' )
+            sum1 = ( sum1 + word[0] + ( word[1] << 8 ) ) % 65535
+            sum2 = ( sum2 + sum1 ) % 65535
+
+        for i in ( 0, 2, 30, 32, 34, 718, 720, 5552, 5552 * 2 + 30, len( data ) - 1, len( data ) + 1 ):
+            self.assertEqual( module.fletcher32( data[:i] ), expected[i] )
+            self.assertEqual( module.fletcher32( data[i:], module.fletcher32( data[:i] ) ), module.fletcher32( data ) )
+
     def test_basics( self ):
         """ Test basic functionality.
         """
         self.do_basics( libscrc )
         self.do_gradually( libscrc )
+        self.do_slicing( libscrc )
+        self.do_clmul( libscrc )
+        self.do_crc32c( libscrc )
+        self.do_adler32( libscrc )
+        self.do_fletcher32( libscrc )
 
     def test_basics_c( self ):
         """Test basic functionality of the extension module.
         """
         self.do_gradually( _crc32 )
         self.do_basics( _crc32 )
+        self.do_slicing( _crc32 )
+        self.do_clmul( _crc32 )
+        self.do_crc32c( _crc32 )
+        self.do_adler32( _crc32 )
+        self.do_fletcher32( _crc32 )
+
+    def test_combine( self ):
+        """ Test libscrc.combine(), parts joined out of order as zlib.crc32_combine().
+        """
+        data  = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 64 * 1024 ) ) )
+        parts = [ data[i:i + 10000] for i in range( 0, len( data ), 10000 ) ]
+
+        for name in ( 'crc32', 'iscsi', 'posix', 'xz64', 'ecma182', 'modbus', 'crc8', 'crc24', 'can15', 'epc' ):
+            func = getattr( libscrc, name )
+            crcs = [ func( part ) for part in reversed( parts ) ][::-1]
+            crc  = crcs[0]
+            for part, value in zip( parts[1:], crcs[1:] ):
+                crc = libscrc.combine( name, crc, value, len( part ) )
+            self.assertEqual( crc, func( data ) )
+            self.assertEqual( libscrc.combine( name, func( data ), func( b'' ), 0 ), func( data ) )
+
+        self.assertEqual( libscrc.combine( 'crc32', zlib.crc32( data[:5] ), zlib.crc32( data[5:] ), len( data ) - 5 ), zlib.crc32( data ) )
+
+        for refin in ( False, True ):
+            for refout in ( False, True ):
+                kws  = dict( poly=0x1EDC6F41, init=0x12345678, xorout=0x0F0F0F0F, refin=refin, refout=refout )
+                crc1 = libscrc.hacker32( data[:1234], reinit=True, **kws )
+                crc2 = libscrc.hacker32( data[1234:], **kws )
+                self.assertEqual( libscrc.combine( 'hacker32', crc1, crc2, len( data ) - 1234, **kws ), libscrc.hacker32( data, **kws ) )
+
+        self.assertRaises( TypeError,  libscrc.combine, 'crc32', 0, 0, 0, poly=0x04C11DB7 )
+        self.assertRaises( ValueError, libscrc.combine, 'unknown', 0, 0, 0 )
 
 if __name__ == '__main__':
     unittest.main()
@@ -11,11 +11,21 @@
 #           2020-04-23 Wheel Ver:1.1   [Heyn] Bug fixed.
 #           2020-08-04 Wheel Ver:1.4   [Heyn] New add gradually calculating
 #           2021-06-08 Wheel Ver:1.7   [Heyn] Optimize the code for hacker64
-
+#           2022-05-20 Wheel Ver:1.8   [Heyn] New add PCLMULQDQ folding test code.
+#           2022-06-01 Wheel Ver:1.8   [Heyn] New add threads=N test code.
+#           2022-06-09 Wheel Ver:1.8   [Heyn] New add CRC82 ( C module, slicing-by-8 ) test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] New add threads=N in the child of a fork() test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] New add threads=N / chunk=N out of range test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] bitwise() is the one of reference.py.
+
+import os
+import time
 import unittest
 import libscrc
 
 from libscrc import _crc64
+from libscrc import _crc82
+from libscrc.test.reference import bitwise
 
 class TestCRC64( unittest.TestCase ):
     """ Test CRC64 IOS ECMA182 GSM40 WE XZ64 variant.
@@ -65,6 +75,19 @@ class TestCRC64( unittest.TestCase ):
         self.assertEqual( module.hacker64(b'123456789', poly=0x42F0E1EBA9EA3693, init=0, xorout=0, refin=False, refout=True,  reinit=True ), 0xE2CE92D0FAFB0236 )
         self.assertEqual( module.hacker64(b'123456789', poly=0x42F0E1EBA9EA3693, init=0, xorout=0, refin=True,  refout=True,  reinit=True ), 0x2B9C7EE4E2780C8A )
 
+    def do_clmul( self, module ):
+        """ Test the carry-less multiply folding ( len >= 64 ) against bit by bit.
+        """
+        data = bytes( bytearray( ( i * 131 + 17 ) & 0xFF for i in range( 300 ) ) )
+        for i in ( 63, 64, 65, 79, 80, 127, 128, 129, 191, 255, 256, 300 ):
+            self.assertEqual( module.ecma182( data[:i] ), bitwise( data[:i], 64, 0x42F0E1EBA9EA3693, 0, False, False, 0 ) )
+            self.assertEqual( module.xz64( data[:i] ),    bitwise( data[:i], 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, True, True, 0xFFFFFFFFFFFFFFFF ) )
+            self.assertEqual( module.gsm40( data[:i] ),   bitwise( data[:i], 40, 0x0004820009, 0, False, False, 0xFFFFFFFFFF ) )
+            self.assertEqual( module.xz64( data[7:i], module.xz64( data[:7] ) ), module.xz64( data[:i] ) )
+            for refin, refout in ( ( True, True ), ( False, False ), ( True, False ), ( False, True ) ):
+                self.assertEqual( module.hacker64( data[:i], poly=0x000000000000001B, init=0x0123456789ABCDEF, xorout=0xFF, refin=refin, refout=refout, reinit=True ),
+                                  bitwise( data[:i], 64, 0x000000000000001B, 0x0123456789ABCDEF, refin, refout, 0xFF ) )
+
     def test_basics( self ):
         """Test basic functionality.
         """
@@ -73,12 +96,33 @@ class TestCRC64( unittest.TestCase ):
         
         self.do_basics( libscrc )
         self.do_gradually( libscrc )
+        self.do_clmul( libscrc )
 
     def test_basics_c( self ):
         """ Test basic functionality of the extension module.
         """
         self.do_gradually( _crc64 )
         self.do_basics( _crc64 )
+        self.do_clmul( _crc64 )
+
+    def test_crc82( self ):
+        """ Test darc82 / hacker82 across the slicing-by-8 blocks against bit by bit, gradually and libscrc.new().
+        """
+        data = bytes( bytearray( ( i * 131 + 17 ) & 0xFF for i in range( 300 ) ) )
+        poly = 0x0308C0111011401440411
+        for i in ( 0, 1, 7, 8, 9, 17, 64, 300 ):
+            self.assertEqual( _crc82.darc82( data[:i] ), bitwise( data[:i], 82, poly, 0, True, True, 0 ) )
+            self.assertEqual( _crc82.darc82( data[i:], _crc82.darc82( data[:i] ) ), _crc82.darc82( data ) )
+            for refin, refout in ( ( True, True ), ( False, False ), ( True, False ), ( False, True ) ):
+                self.assertEqual( _crc82.hacker82( data[:i], poly=poly ^ ( 1 << 81 ), init=0x123456789ABCDEF012345, xorout=0x3FFFF, refin=refin, refout=refout, reinit=True ),
+                                  bitwise( data[:i], 82, poly ^ ( 1 << 81 ), 0x123456789ABCDEF012345, refin, refout, 0x3FFFF ) )
+
+        crc = libscrc.new( 'darc82' )
+        crc.update( data[:5] )
+        crc.update( data[5:] )
+        self.assertEqual( crc.intdigest(), libscrc.darc82( data ) )
+        self.assertEqual( crc.digest(), bytes( bytearray( ( libscrc.darc82( data ) >> ( 8 * i ) ) & 0xFF for i in range( 10, -1, -1 ) ) ) )
+        self.assertEqual( libscrc.new( 'hacker82', data, poly=0x1021, refin=True ).intdigest(), bitwise( data, 82, 0x1021, 0, True, False, 0 ) )
 
     def test_big_chunks( self ):
         """ Test calculation of CRC on big chunks of data.
@@ -86,5 +130,53 @@ class TestCRC64( unittest.TestCase ):
         self.assertEqual( _crc64.iso(b'A' * 16 * 1024 * 1024),     0x799F69518B336624 )
         self.assertEqual( _crc64.ecma182(b'A' * 16 * 1024 * 1024), 0xF8A0D6AC4D42F9A6 )
 
+    def test_threads( self ):
+        """ Test threads=N, parts hashed on the worker pool and joined with combine().
+        """
+        data = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 3 * 1024 * 1024 + 17 ) ) )
+
+        self.assertEqual( _crc64.iso(b'A' * 16 * 1024 * 1024, threads=4),     0x799F69518B336624 )
+        self.assertEqual( _crc64.ecma182(b'A' * 16 * 1024 * 1024, threads=4), 0xF8A0D6AC4D42F9A6 )
+        for name in ( 'xz64', 'crc32', 'iscsi', 'modbus', 'crc8', 'crc24', 'epc', 'can15' ):
+            func = getattr( libscrc, name )
+            for threads, chunk in ( ( 2, 1024 * 1024 ), ( 8, 1024 * 1024 ), ( 64, 5000 ), ( 3, 0 ) ):
+                self.assertEqual( func( data, threads=threads, chunk=chunk ), func( data ) )
+            crc = func( data[:1000] )
+            self.assertEqual( func( data[1000:], crc, threads=4, chunk=4096 ), func( data ) )
+            self.assertRaises( OverflowError, func, data, threads=1 << 32 )
+            self.assertRaises( OverflowError, func, data, threads=-1 )
+            self.assertRaises( OverflowError, func, data, threads=2, chunk=1 << 32 )
+            self.assertRaises( ValueError, func, data, threads=0 )
+
+    @unittest.skipUnless( hasattr( os, 'fork' ), 'no os.fork()' )
+    def test_threads_fork( self ):
+        """ Test threads=N in the child of a fork(), the worker pool is started again there.
+        """
+        data = b'A' * 16 * 1024 * 1024
+        self.assertEqual( _crc64.iso( data, threads=4 ), 0x799F69518B336624 )
+
+        pid = os.fork()
+        if pid == 0:
+            status = 1
+            try:
+                if _crc64.iso( data, threads=4 ) == 0x799F69518B336624:
+                    status = 0
+                if os.path.isdir( '/proc/self/task' ) and ( len( os.listdir( '/proc/self/task' ) ) < 4 ):
+                    status = 2      # No workers in the child
+            finally:
+                os._exit( status )
+
+        for _ in range( 600 ):
+            done, status = os.waitpid( pid, os.WNOHANG )
+            if done:
+                break
+            time.sleep( 0.1 )
+        else:
+            os.kill( pid, 9 )
+            os.waitpid( pid, 0 )
+            self.fail( 'threads=4 hangs in the child of a fork()' )
+        self.assertTrue( os.WIFEXITED( status ) )
+        self.assertEqual( os.WEXITSTATUS( status ), 0 )
+
 if __name__ == '__main__':
     unittest.main()
@@ -10,8 +10,11 @@
 #           2020-04-30 Wheel Ver:1.3   [Heyn] Optimized code
 #           2021-06-07 Wheel Ver:1.7   [Heyn] New add hacker8 hacker24 hacker64 test code.
 #           2021-06-08 Wheel Ver:1.7   [Heyn] If the polynomial changes, you need to set reinit=True
+#           2022-05-23 Wheel Ver:1.8   [Heyn] New add threads test code ( GIL released ).
+#           2022-06-10 Wheel Ver:1.8   [Heyn] New add cache test code ( no reinit when the polynomial changes ).
 
 import unittest
+import threading
 
 import libscrc
 from libscrc import _crc8
@@ -96,5 +99,41 @@ class TestHacker( unittest.TestCase ):
         self.do_basics_32( _crc32 )
         self.do_basics_64( _crc64 )
 
+    def test_cache( self ):
+        """ The tables are cached per ( poly, refin, refout ), reinit is not needed when the model changes.
+            80 models are more than the cache keeps, the second round rebuilds the evicted ones.
+        """
+        data = b'123456789' * 3
+        for name, width in ( ( 'hacker8', 8 ), ( 'hacker16', 16 ), ( 'hacker24', 24 ), ( 'hacker32', 32 ), ( 'hacker64', 64 ) ):
+            hacker = getattr( libscrc, name )
+            models = [ ( ( ( i * 0x9E3779B97F4A7C15 ) >> ( 64 - width ) ) | 1, bool( i & 1 ), bool( i & 2 ) ) for i in range( 1, 81 ) ]
+            expected = [ libscrc.new( name, data, poly=p, init=0, xorout=0, refin=i, refout=o ).intdigest() for p, i, o in models ]
+            for _ in range( 2 ):
+                results = [ hacker( data, poly=p, init=0, xorout=0, refin=i, refout=o ) for p, i, o in models ]
+                self.assertEqual( results, expected, name )
+
+    def test_threads( self ):
+        """ Large buffers are computed without the GIL, other threads may reinit hacker meanwhile.
+        """
+        data  = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 64 * 1024 ) ) )
+        polys = ( 0x1021, 0x8005, 0x3D65, 0x0589 )
+        calls = [ ( lambda p=p: libscrc.hacker16( data, poly=p, init=0, xorout=0, refin=False, refout=False, reinit=True ) ) for p in polys ]
+        calls.append( lambda: libscrc.modbus( data ) )
+        calls.append( lambda: libscrc.crc32( data ) )
+        expected = [ call() for call in calls ]
+
+        errors = []
+        def worker( index ):
+            for _ in range( 20 ):
+                if calls[index]() != expected[index]:
+                    errors.append( index )
+
+        threads = [ threading.Thread( target=worker, args=( i, ) ) for i in range( len( calls ) ) ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual( errors, [] )
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,92 @@
+# -*- coding:utf-8 -*-
+""" Test library for the kernel dispatch """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Test library libscrc.cpu_features() / kernel_for() and LIBSCRC_KERNEL.
+# Package:  pip install libscrc.
+# History:  2022-06-13 Wheel Ver:1.8   [Heyn] Initialize
+#           2022-06-14 Wheel Ver:1.8   [Heyn] New add AVX-512 VPCLMULQDQ kernel test code.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] New add Model.kernel test code ( same as kernel_for() of the built-in model ).
+
+import os
+import sys
+import subprocess
+import unittest
+
+import libscrc
+
+MODELS = ( 'crc32', 'crc32_c', 'mpeg2', 'hacker32', 'ecma182', 'gsm40', 'modbus', 'xmodem', 'crc8', 'maxim8',
+           'crc24', 'usb5', 'can15', 'darc82', 'adler32', 'fletcher32' )
+
+# Model( width, poly, init, refin, refout, xorout ) of the built-in models of the crc32 / crc64 engines.
+EQUIVALENTS = ( ( 'crc32',   ( 32, 0x04C11DB7, 0xFFFFFFFF, True, True, 0xFFFFFFFF ) ),
+                ( 'crc32_c', ( 32, 0x1EDC6F41, 0xFFFFFFFF, True, True, 0xFFFFFFFF ) ),
+                ( 'mpeg2',   ( 32, 0x04C11DB7, 0xFFFFFFFF, False, False, 0x00000000 ) ),
+                ( 'ecma182', ( 64, 0x42F0E1EBA9EA3693, 0x0000000000000000, False, False, 0x0000000000000000 ) ),
+                ( 'gsm40',   ( 40, 0x0004820009, 0x0000000000, False, False, 0xFFFFFFFFFF ) ) )
+
+# Prints the kernels, the CRCs of the models and the Model.kernel / kernel_for() pairs, run with each LIBSCRC_KERNEL.
+SCRIPT = """
+import random, libscrc
+rand = random.Random( 2022 )
+kernels = [ libscrc.kernel_for( name ) for name in {models!r} if name not in ( 'adler32', 'fletcher32' ) ]
+pairs = [ ( libscrc.Model( *args ).kernel, libscrc.kernel_for( name ) ) for name, args in {equivalents!r} ]
+crcs = []
+for size in ( 0, 1, 7, 8, 15, 16, 63, 64, 65, 255, 256, 1023, 4096 + 13, 65536 + 5 ):
+    data = bytes( bytearray( rand.getrandbits( 8 ) for _ in range( size ) ) )
+    crcs.append( [ getattr( libscrc, name )( data ) for name in {models!r} ] )
+print( repr( ( kernels, crcs, pairs ) ) )
+""".format( models=MODELS, equivalents=EQUIVALENTS )
+
+
+class TestKernel( unittest.TestCase ):
+    """ Test the kernel dispatch.
+    """
+
+    def run_kernel( self, kernel ):
+        env = dict( os.environ )
+        env['LIBSCRC_KERNEL'] = kernel
+        env['PYTHONPATH'] = os.path.dirname( os.path.dirname( os.path.abspath( libscrc.__file__ ) ) )
+        out = subprocess.check_output( [ sys.executable, '-c', SCRIPT ], env=env )
+        return eval( out.decode( 'ascii' ) )
+
+    def test_introspection( self ):
+        """ cpu_features() and kernel_for() of this CPU.
+        """
+        features = libscrc.cpu_features()
+        for name in ( 'ssse3', 'sse4.1', 'sse4.2', 'pclmul', 'avx2', 'avx512', 'vpclmul' ):
+            self.assertIn( features[name], ( True, False ) )
+
+        for name in MODELS[:-2] + ( 'hacker8', 'hacker16', 'hacker24', 'hacker64', 'hacker82' ):
+            self.assertIn( libscrc.kernel_for( name ), libscrc.KERNELS )
+        if features['avx512'] and features['vpclmul']:
+            self.assertEqual( libscrc.kernel_for( 'crc32_c' ), 'avx512' )
+            self.assertEqual( libscrc.kernel_for( 'modbus' ), 'avx512' )
+            self.assertEqual( libscrc.kernel_for( 'hacker64' ), 'avx512' )
+        elif features['pclmul'] and features['ssse3']:
+            self.assertEqual( libscrc.kernel_for( 'modbus' ), 'pclmul' )
+        if features['sse4.2'] and not features['vpclmul']:
+            self.assertEqual( libscrc.kernel_for( 'crc32_c' ), 'sse4.2' )
+        self.assertEqual( libscrc.kernel_for( 'darc82' ), 'slicing' )
+        self.assertRaises( ValueError, libscrc.kernel_for, 'crc33' )
+
+    def test_kernels( self ):
+        """ LIBSCRC_KERNEL caps the dispatch, every kernel computes the same CRCs.
+        """
+        expect = self.run_kernel( '' )[1]
+        for kernel in libscrc.KERNELS:
+            kernels, crcs, pairs = self.run_kernel( kernel )
+            for name in kernels:
+                self.assertLessEqual( libscrc.KERNELS.index( name ), libscrc.KERNELS.index( kernel ), kernel )
+            self.assertEqual( crcs, expect, kernel )
+            for model, builtin in pairs:
+                self.assertEqual( model, builtin, kernel )
+
+        kernels, crcs, pairs = self.run_kernel( 'scalar' )
+        self.assertEqual( set( kernels ), set( [ 'scalar' ] ) )
+        self.assertEqual( set( pairs ), set( [ ( 'scalar', 'scalar' ) ] ) )
+
+if __name__ == '__main__':
+    unittest.main()
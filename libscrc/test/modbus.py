@@ -9,6 +9,8 @@
 # History:  2017-08-17 Wheel Ver:0.0.3 [Heyn] Initialize
 #           2020-04-30 Wheel Ver:1.3   [Heyn] Optimized code, removed two steps compute function
 #           2022-03-04 Wheel Ver:1.8   [Heyn] New add modbus ascii checksum.
+#           2022-06-03 Wheel Ver:1.8   [Heyn] New add libscrc.batch() test code.
+#           2022-06-05 Wheel Ver:1.8   [Heyn] New add positional and keyword arguments test code.
 
 import unittest
 import libscrc
@@ -52,6 +54,35 @@ class TestModbusRTU( unittest.TestCase ):
         """
         self.assertEqual( _crc16.modbus( b'A' * 16 * 1024 * 1024 ), 0x588F )
 
+    def test_batch( self ):
+        """ Test many frames in one call, a list of frames or one buffer and offsets.
+        """
+        frames = [ b'123456789', b'', b'AAAAAAAAAAAAAAAAAAAAAA', b'A' * 4096 * 10 ]
+        expect = [ 0x4B37, 0xFFFF, 0xDAB3, 0x9A78 ]
+
+        self.assertEqual( libscrc.batch( 'modbus', frames ).tolist(), expect )
+        self.assertEqual( libscrc.batch( 'modbus', b''.join( frames ), [ 0, 9, 9, 31, 31 + 4096 * 10 ] ).tolist(), expect )
+        self.assertEqual( libscrc.batch( 'modbus', [] ).tolist(), [] )
+        self.assertEqual( libscrc.batch( 'modbus', frames ).typecode, 'H' )
+
+        self.assertRaises( ValueError, libscrc.batch, 'modbus', b'123', [ 0, 4 ] )
+        self.assertRaises( ValueError, libscrc.batch, 'modbus', b'123', [ 2, 1 ] )
+        self.assertRaises( TypeError,  libscrc.batch, 'modbus', [ b'123', 123 ] )
+
+    def test_arguments( self ):
+        """ Test data and init passed by position or by keyword.
+        """
+        crc = libscrc.modbus( b'1234' )
+        self.assertEqual( libscrc.modbus( data=b'123456789' ), 0x4B37 )
+        self.assertEqual( libscrc.modbus( b'56789', crc ), 0x4B37 )
+        self.assertEqual( libscrc.modbus( init=crc, data=b'56789' ), 0x4B37 )
+
+        self.assertRaises( TypeError, libscrc.modbus )
+        self.assertRaises( TypeError, libscrc.modbus, b'123', data=b'123' )
+        self.assertRaises( TypeError, libscrc.modbus, b'123', poly=0x8005 )
+        self.assertRaises( TypeError, libscrc.modbus, b'123', 1.0 )
+        self.assertRaises( TypeError, libscrc.modbus, '123' )
+
 class TestModbusASC( unittest.TestCase ):
 
     def do_basics( self, module ):
@@ -0,0 +1,78 @@
+# -*- coding:utf-8 -*-
+""" Test library for CRC models """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Test library libscrc.Model.
+# Package:  pip install libscrc.
+# History:  2022-06-11 Wheel Ver:1.8   [Heyn] Initialize
+#           2022-06-15 Wheel Ver:1.8   [Heyn] bitwise() is the one of reference.py.
+
+import unittest
+import random
+
+import libscrc
+from libscrc.test.reference import bitwise
+
+class TestModel( unittest.TestCase ):
+    """ Test libscrc.Model.
+    """
+
+    def test_models( self ):
+        """ The models of the library.
+        """
+        data = b'123456789'
+        self.assertEqual( libscrc.Model( 16, 0x8005, 0xFFFF, True, True, 0x0000 )( data ), libscrc.modbus( data ) )
+        self.assertEqual( libscrc.Model( 16, 0x1021, 0xFFFF )( data ), libscrc.ccitt_false( data ) )
+        self.assertEqual( libscrc.Model( 32, 0x04C11DB7, 0xFFFFFFFF, True, True, 0xFFFFFFFF )( data ), libscrc.crc32( data ) )
+        self.assertEqual( libscrc.Model( 32, 0x1EDC6F41, 0xFFFFFFFF, True, True, 0xFFFFFFFF )( data ), libscrc.crc32_c( data ) )
+        self.assertEqual( libscrc.Model( 31, 0x04C11DB7, 0x7FFFFFFF, False, False, 0x7FFFFFFF )( data ), libscrc.philips( data ) )
+        self.assertEqual( libscrc.Model( 64, 0x42F0E1EBA9EA3693, 0, False, False, 0 )( data ), libscrc.ecma182( data ) )
+        self.assertEqual( libscrc.Model( 40, 0x0004820009, 0, False, False, 0xFFFFFFFFFF )( data ), libscrc.gsm40( data ) )
+        self.assertEqual( libscrc.Model( 3, 0x3, 0x7, True, True, 0x0 )( data ), 0x6 )
+        self.assertEqual( libscrc.Model( 12, 0x80F, 0x000, False, True, 0x000 )( data ), 0xDAF )
+
+    def test_widths( self ):
+        """ Every width, reflected or not, against the bitwise reference.
+        """
+        rand = random.Random( 2022 )
+        for width in range( 3, 65 ):
+            for refin in ( False, True ):
+                for refout in ( False, True ):
+                    poly, init, xorout = rand.getrandbits( width ) | 1, rand.getrandbits( width ), rand.getrandbits( width )
+                    model = libscrc.Model( width, poly, init=init, refin=refin, refout=refout, xorout=xorout )
+                    for size in ( 0, 1, 8, 9, 64, 200 ):
+                        data = bytes( bytearray( rand.getrandbits( 8 ) for _ in range( size ) ) )
+                        self.assertEqual( model( data ), bitwise( data, width, poly, init, refin, refout, xorout ), repr( model ) )
+
+    def test_methods( self ):
+        """ new(), combine() and batch() agree with the model.
+        """
+        part1, part2 = b'1234' * 300, b'56789' * 2000
+        for width, poly, refin in ( ( 8, 0x07, False ), ( 16, 0x1021, True ), ( 24, 0x864CFB, False ), ( 32, 0x04C11DB7, True ), ( 64, 0x42F0E1EBA9EA3693, True ) ):
+            model = libscrc.Model( width, poly, refin=refin, refout=refin, xorout=( 1 << width ) - 1 )
+
+            crc = model.new( part1 )
+            copy = crc.copy()
+            copy.update( part2 )
+            self.assertEqual( crc.intdigest(), model( part1 ) )
+            self.assertEqual( copy.intdigest(), model( part1 + part2 ) )
+            self.assertEqual( copy.digest_size, ( width + 7 ) // 8 )
+            self.assertEqual( int( copy.hexdigest(), 16 ), copy.intdigest() )
+
+            self.assertEqual( model.combine( model( part1 ), model( part2 ), len( part2 ) ), model( part1 + part2 ) )
+            self.assertEqual( list( model.batch( [ part1, part2, b'' ] ) ), [ model( part1 ), model( part2 ), model( b'' ) ] )
+            self.assertEqual( list( model.batch( part1 + part2, [ 0, len( part1 ), len( part1 + part2 ) ] ) ), [ model( part1 ), model( part2 ) ] )
+
+    def test_errors( self ):
+        """ Widths out of 3 .. 64 and values wider than the model.
+        """
+        self.assertRaises( ValueError, libscrc.Model, 2, 0x3 )
+        self.assertRaises( ValueError, libscrc.Model, 65, 0x3 )
+        self.assertRaises( ValueError, libscrc.Model, 8, 0x107 )
+        self.assertRaises( ValueError, libscrc.Model, 8, 0x07, init=0x100 )
+        self.assertRaises( TypeError, libscrc.Model( 8, 0x07 ) )
+
+if __name__ == '__main__':
+    unittest.main()
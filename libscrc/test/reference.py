@@ -0,0 +1,21 @@
+# -*- coding:utf-8 -*-
+""" Reference CRC for the tests """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Bit by bit CRC of any model, the tests check the C modules against it.
+# Package:  pip install libscrc.
+# History:  2022-06-15 Wheel Ver:1.8   [Heyn] Initialize ( was copied in crc32.py, crc64.py and model.py )
+
+def bitwise( data, width, poly, init, refin, refout, xorout ):
+    """ Bit by bit reference.
+    """
+    crc, top, mask = init, 1 << ( width - 1 ), ( 1 << width ) - 1
+    for c in bytearray( data ):
+        for i in ( range( 8 ) if refin else range( 7, -1, -1 ) ):
+            bit = ( ( c >> i ) & 1 ) ^ ( 1 if crc & top else 0 )
+            crc = ( ( crc << 1 ) & mask ) ^ ( poly if bit else 0 )
+    if refout:
+        crc = int( '{0:0{1}b}'.format( crc, width )[::-1], 2 )
+    return crc ^ xorout
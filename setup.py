@@ -1,7 +1,9 @@
 # -*- coding:utf-8 -*-
 """ Setup script for CRC8/CRC16/CRC24/CRC32/CRC64/CRC82 library. """
+import sys
 from os import path
 from setuptools import setup, find_packages, Extension
+from setuptools.command.build_ext import build_ext as _build_ext
 from codecs import open
 
 # !/usr/bin/python
@@ -21,9 +23,43 @@ from codecs import open
 #           2020-08-04 Wheel Ver:1.4   [Heyn] Issues #4
 #           2021-03-17 Wheel Ver:1.7   [Heyn] Developing.
 #           2022-03-04 Wheel Ver:1.8   [Heyn] New add modbus(ASCII) checksum(LRC).
+#           2022-05-16 Wheel Ver:1.8   [Heyn] New add PCLMULQDQ folding for CRC32 (src/common).
+#           2022-05-18 Wheel Ver:1.8   [Heyn] New add SSE4.2 CRC32C.
+#           2022-05-20 Wheel Ver:1.8   [Heyn] New add PCLMULQDQ folding for CRC64.
+#           2022-05-27 Wheel Ver:1.8   [Heyn] Generate the tables of the built-in models (src/gentables.py).
+#           2022-06-01 Wheel Ver:1.8   [Heyn] New add threads=N worker pool (src/common/_hexin_pool.c).
+#           2022-06-03 Wheel Ver:1.8   [Heyn] New add libscrc.batch() (src/common/_hexin_batch.c).
+#           2022-06-05 Wheel Ver:1.8   [Heyn] Model functions are METH_FASTCALL (src/common/_hexin_fastcall.c).
+#           2022-06-06 Wheel Ver:1.8   [Heyn] Adler-32 reduced per NMAX bytes, SSSE3/AVX2 (src/common/_hexin_adler32.c).
+#           2022-06-07 Wheel Ver:1.8   [Heyn] Internet checksum with 64-bit sums, AVX2, RFC 1624 update (src/common/_hexin_network.c).
+#           2022-06-08 Wheel Ver:1.8   [Heyn] Fletcher-8/16/32 reduced per block, AVX2 (src/common/_hexin_fletcher.c).
+#           2022-06-09 Wheel Ver:1.8   [Heyn] CRC82 in C (src/crc82), was the bit loop of libscrc/_crc82.py.
+#           2022-06-10 Wheel Ver:1.8   [Heyn] hacker8/16/24/32/64/82 tables cached per model (src/common/_hexin_cache.c).
+#           2022-06-11 Wheel Ver:1.8   [Heyn] New add libscrc.Model, CRC models of any width compiled once (src/model).
+#           2022-06-12 Wheel Ver:1.8   [Heyn] One CRC engine for crc8/16/24/32/64/x/canx (src/common/_hexin_core.h).
+#           2022-06-13 Wheel Ver:1.8   [Heyn] Kernels dispatched at import, LIBSCRC_KERNEL=<kernel> caps them (src/common/_hexin_cpu.c).
+#           2022-06-15 Wheel Ver:1.8   [Heyn] Tables generated by build_ext into the build directory, from src/<module>/_<module>models.h.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] One worker pool per process, libscrc._pool (src/pool), the others import its capsule.
+#           2022-06-15 Wheel Ver:1.8   [Heyn] Incremental objects have a lock (src/common/_hexin_lock.c).
 
 here = path.abspath(path.dirname(__file__))
 
+
+class build_ext(_build_ext):
+    """ static const tables of the built-in models ( src/<module>/_<module>models.h ) -> <build_temp>/gentables """
+    def run(self):
+        sys.path.insert(0, path.join(here, 'src'))
+        import gentables
+        outdir = path.join(self.build_temp, 'gentables')
+        gentables.generate(path.join(here, 'src'), outdir)
+        for extension in self.extensions:
+            extension.include_dirs.append(outdir)
+        _build_ext.run(self)
+
+
+# threads=N worker pool (src/common/_hexin_pool.c), one per process in libscrc._pool
+POOL_LIBRARIES = [] if sys.platform == 'win32' else ['pthread']
+
 with open(path.join(here, 'README.rst'), encoding='utf-8') as f:
     long_description = f.read()
     long_description = long_description.replace("\r", "")
@@ -75,12 +111,63 @@ setup(
 
     include_package_data=True,
 
-    ext_modules=[Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c'  ]),
-                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c'  ]),
-                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c'  ]),
-                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c']),
-                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c']),
-                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c']),
-                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c']),
+    cmdclass={'build_ext': build_ext},
+
+    ext_modules=[Extension('libscrc._pool',  sources=['src/pool/_poolmodule.c',   'src/common/_hexin_pool.c'],
+                                             include_dirs=['src/common'], libraries=POOL_LIBRARIES),
+                 Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c',
+                                                      'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_cpu.c',
+                                                      'src/common/_hexin_fletcher.c', 'src/common/_hexin_cache.c',
+                                                      'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c',
+                                                      'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_cpu.c',
+                                                      'src/common/_hexin_network.c', 'src/common/_hexin_fletcher.c',
+                                                      'src/common/_hexin_cache.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_cache.c',
+                                                      'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_crc32c.c', 'src/common/_hexin_poolapi.c',
+                                                      'src/common/_hexin_batch.c', 'src/common/_hexin_fastcall.c',
+                                                      'src/common/_hexin_adler32.c', 'src/common/_hexin_fletcher.c',
+                                                      'src/common/_hexin_cache.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_clmul.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_cache.c',
+                                                      'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._crc82', sources=['src/crc82/_crc82module.c', 'src/crc82/_crc82tables.c',
+                                                      'src/common/_hexin_cpu.c',  'src/common/_hexin_fastcall.c',
+                                                      'src/common/_hexin_cache.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common']),
+                 Extension('libscrc._model', sources=['src/model/_modelmodule.c', 'src/crc32/_crc32tables.c',
+                                                      'src/crc64/_crc64tables.c', 'src/common/_hexin_cpu.c',
+                                                      'src/common/_hexin_clmul.c', 'src/common/_hexin_crc32c.c',
+                                                      'src/common/_hexin_poolapi.c', 'src/common/_hexin_batch.c',
+                                                      'src/common/_hexin_fastcall.c', 'src/common/_hexin_adler32.c',
+                                                      'src/common/_hexin_fletcher.c', 'src/common/_hexin_lock.c'],
+                                             include_dirs=['src/common', 'src/crc32', 'src/crc64']),
                 ],
 )
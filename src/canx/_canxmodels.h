@@ -0,0 +1,22 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _canxmodels.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_canx of _canxmodule.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _canxgentables.h ) and by _canxmodule.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly        init        refin   refout  xorout */
+HEXIN_MODEL( canx_param_can15,             15,    0x00004599, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( canx_param_can17,             17,    0x0001685B, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( canx_param_can21,             21,    0x00102899, 0x00000000, FALSE,  FALSE,  0x00000000 )
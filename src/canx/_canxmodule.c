@@ -12,140 +12,96 @@
 *                       2020-04-27 [Heyn] Optimized Code.
 *                       2020-05-12 [Heyn] (Python2.7) FIX : Windows compilation error.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, batch() hashes frames in lockstep ( compute_multi ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _canxmodels.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 *********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_canxtables.h"
+#include "_canxgentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _canxmodels.h ), the tables are the ones generated by setup.py ( _canxgentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_canx param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_canxmodels.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_canx *param;
+} hexin_canx_models[] = {
+    { "can15", &canx_param_can15 },
+    { "can17", &canx_param_can17 },
+    { "can21", &canx_param_can21 },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_canx *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
-    }
-
-    param->result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
+#define                 HEXIN_MODULE_NAME                       canx
+#define                 HEXIN_MODULE_TYPE                       unsigned int
+#define                 HEXIN_MODULE_BITS                       32
+#define                 HEXIN_MODULE_TITLE                      "CANX"
+#include "_hexin_module.h"
 
-static PyObject * _canx_can15( PyObject *self, PyObject *args )
+static PyObject * _canx_can15( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can15 = { .is_initial=FALSE,
-                                                   .width  = 15,
-                                                   .poly   = CAN15_POLYNOMIAL_00004599,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-#else
-    static struct _hexin_canx canx_param_can15 = { FALSE,
-                                                   15,
-                                                   CAN15_POLYNOMIAL_00004599,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
-#endif  /* PY_MAJOR_VERSION */
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can15 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &canx_param_can15, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", (unsigned short)( canx_param_can15.result & 0x00007FFF ) );
+    return hexin_PyLong_FromUnsigned( (unsigned short)( result & 0x00007FFF ) );
 }
 
-static PyObject * _canx_can17( PyObject *self, PyObject *args )
+static PyObject * _canx_can17( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can17 = { .is_initial=FALSE,
-                                                   .width  = 17,
-                                                   .poly   = CAN17_POLYNOMIAL_0001685B,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-#else
-    static struct _hexin_canx canx_param_can17 = { FALSE,
-                                                   17,
-                                                   CAN17_POLYNOMIAL_0001685B,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can17 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &canx_param_can17, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can17.result & 0x1FFFF) );
+    return hexin_PyLong_FromUnsigned( (result & 0x1FFFF) );
 }
 
-static PyObject * _canx_can21( PyObject *self, PyObject *args )
+static PyObject * _canx_can21( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can21= { .is_initial=FALSE,
-                                                   .width  = 21,
-                                                   .poly   = CAN21_POLYNOMIAL_00102899,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-#else
-    static struct _hexin_canx canx_param_can21 = { FALSE,
-                                                   21,
-                                                   CAN21_POLYNOMIAL_00102899,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
-#endif  /* PY_MAJOR_VERSION */
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can21 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &canx_param_can21, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can21.result & 0x001FFFFF) );
+    return hexin_PyLong_FromUnsigned( (result & 0x001FFFFF) );
 }
 
 /* method table */
 static PyMethodDef _canxMethods[] = {
-    { "can15",      (PyCFunction)_canx_can15, METH_VARARGS, "Calculate CAN15 [Poly=0x004599, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"   },
-    { "can17",      (PyCFunction)_canx_can17, METH_VARARGS, "Calculate CAN17 [Poly=0x01685B, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"  },
-    { "can21",      (PyCFunction)_canx_can21, METH_VARARGS, "Calculate CAN21 [Poly=0x102899, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]" },
+    { "can15",      (PyCFunction)_canx_can15, HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CAN15 [Poly=0x004599, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"   },
+    { "can17",      (PyCFunction)_canx_can17, HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CAN17 [Poly=0x01685B, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"  },
+    { "can21",      (PyCFunction)_canx_can21, HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CAN21 [Poly=0x102899, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]" },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -177,6 +133,18 @@ PyInit__canx( void )
 {
     PyObject *m = NULL;
 
+    if ( hexin_canx_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_canx_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_canxmodule );
     if ( m == NULL ) {
         return NULL;
@@ -194,6 +162,14 @@ PyInit__canx( void )
 PyMODINIT_FUNC
 init_canx( void )
 {
+    if ( hexin_canx_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_canx_compute() may run without the GIL. */
+    hexin_cpu_features();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     (void) Py_InitModule3( "_canx", _canxMethods, _canx_doc );
 }
 
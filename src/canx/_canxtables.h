@@ -11,6 +11,14 @@
 *		New Create at 	2020-04-21 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized Code.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -18,6 +26,8 @@
 #ifndef __CANX_TABLES_H__
 #define __CANX_TABLES_H__
 
+#include <stddef.h>
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -32,25 +42,16 @@
 
 #define                 HEXIN_CANX_WIDTH                        32
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
 
 #define                 CAN15_POLYNOMIAL_00004599               0x00004599L
 #define                 CAN17_POLYNOMIAL_0001685B               0x0001685BL
 #define                 CAN21_POLYNOMIAL_00102899               0x00102899L
 
-struct _hexin_canx {
-    unsigned int  is_initial;
-    unsigned int  is_gradual;
-    unsigned int  width;
-    unsigned int  poly;
-    unsigned int  init;
-    unsigned int  refin;
-    unsigned int  refout;
-    unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
-};
-
-unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_canx *param, unsigned int init );
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         canx
+#define                 HEXIN_CORE_TYPE                         unsigned int
+#define                 HEXIN_CORE_BITS                         32
+#include "_hexin_core.h"
 
 #endif //__CANX_TABLES_H__
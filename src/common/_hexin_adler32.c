@@ -0,0 +1,209 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_adler32.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-06 [Heyn] Initialize.
+*                       2022-06-15 [Heyn] A value with a half >= 65521 is reduced first, adler32( b'', 0xFFFFFFFF ) as zlib.
+*
+*********************************************************************************************************
+*/
+
+#include "_hexin_adler32.h"
+
+#if defined( HEXIN_X86_64 )
+#include <immintrin.h>
+#endif /* HEXIN_X86_64 */
+
+#define __HEXIN_ADLER32_DO1( p, i )     { sum1 += ( p )[i]; sum2 += sum1; }
+#define __HEXIN_ADLER32_DO4( p, i )     __HEXIN_ADLER32_DO1( p, i ) __HEXIN_ADLER32_DO1( p, i + 1 ) \
+                                        __HEXIN_ADLER32_DO1( p, i + 2 ) __HEXIN_ADLER32_DO1( p, i + 3 )
+#define __HEXIN_ADLER32_DO16( p )       __HEXIN_ADLER32_DO4( p, 0 ) __HEXIN_ADLER32_DO4( p, 4 ) \
+                                        __HEXIN_ADLER32_DO4( p, 8 ) __HEXIN_ADLER32_DO4( p, 12 )
+
+/*
+ * Sums are reduced once per NMAX bytes instead of twice per byte.
+ */
+static unsigned int __hexin_adler32_scalar( const unsigned char *pSrc, size_t len, unsigned int adler )
+{
+    unsigned int sum1 = adler & 0xFFFF;
+    unsigned int sum2 = ( adler >> 16 ) & 0xFFFF;
+    size_t n = 0;
+
+    while ( len >= HEXIN_ADLER32_NMAX ) {
+        len -= HEXIN_ADLER32_NMAX;
+        n    = HEXIN_ADLER32_NMAX / 16;
+        do {
+            __HEXIN_ADLER32_DO16( pSrc );
+            pSrc += 16;
+        } while ( --n );
+        sum1 %= HEXIN_ADLER32_BASE;
+        sum2 %= HEXIN_ADLER32_BASE;
+    }
+
+    if ( len ) {
+        while ( len >= 16 ) {
+            __HEXIN_ADLER32_DO16( pSrc );
+            pSrc += 16;
+            len  -= 16;
+        }
+        while ( len-- ) {
+            __HEXIN_ADLER32_DO1( pSrc, 0 );
+            pSrc++;
+        }
+        sum1 %= HEXIN_ADLER32_BASE;
+        sum2 %= HEXIN_ADLER32_BASE;
+    }
+
+    return ( sum2 << 16 ) | sum1;
+}
+
+#if defined( HEXIN_X86_64 )
+
+/*
+ * Per block of 32 bytes b[0..31] :
+ *   sum2 += 32 * sum1 + 32 * b[0] + 31 * b[1] + ... + 1 * b[31]
+ *   sum1 += b[0] + b[1] + ... + b[31]
+ * psadbw adds the bytes, pmaddubsw + pmaddwd the weighted bytes. The 32 * sum1 terms are
+ * accumulated in v_ps and added once per NMAX run, NMAX / 32 blocks fit in the 32-bit lanes.
+ */
+
+HEXIN_TARGET( "ssse3" )
+static unsigned int __hexin_adler32_hsum128( __m128i v )
+{
+    v = _mm_add_epi32( v, _mm_shuffle_epi32( v, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    v = _mm_add_epi32( v, _mm_shuffle_epi32( v, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    return ( unsigned int )_mm_cvtsi128_si32( v );
+}
+
+HEXIN_TARGET( "ssse3" )
+static unsigned int __hexin_adler32_ssse3( const unsigned char *pSrc, size_t len, unsigned int adler )
+{
+    unsigned int sum1 = adler & 0xFFFF;
+    unsigned int sum2 = ( adler >> 16 ) & 0xFFFF;
+    size_t blocks = len / HEXIN_ADLER32_BLOCK;
+    size_t n = 0;
+
+    const __m128i tap1 = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+    const __m128i tap2 = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16( 1 );
+
+    len -= blocks * HEXIN_ADLER32_BLOCK;
+    while ( blocks ) {
+        __m128i v_ps = zero, v_s1 = zero, v_s2 = zero;
+
+        n = HEXIN_ADLER32_NMAX / HEXIN_ADLER32_BLOCK;
+        if ( n > blocks ) {
+            n = blocks;
+        }
+        blocks -= n;
+        v_ps = _mm_set_epi32( 0, 0, 0, ( int )( sum1 * n ) );
+        v_s2 = _mm_set_epi32( 0, 0, 0, ( int )sum2 );
+
+        do {
+            const __m128i bytes1 = _mm_loadu_si128( ( const __m128i * )pSrc );
+            const __m128i bytes2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+
+            v_ps = _mm_add_epi32( v_ps, v_s1 );
+            v_s1 = _mm_add_epi32( v_s1, _mm_sad_epu8( bytes1, zero ) );
+            v_s2 = _mm_add_epi32( v_s2, _mm_madd_epi16( _mm_maddubs_epi16( bytes1, tap1 ), ones ) );
+            v_s1 = _mm_add_epi32( v_s1, _mm_sad_epu8( bytes2, zero ) );
+            v_s2 = _mm_add_epi32( v_s2, _mm_madd_epi16( _mm_maddubs_epi16( bytes2, tap2 ), ones ) );
+            pSrc += HEXIN_ADLER32_BLOCK;
+        } while ( --n );
+
+        v_s2  = _mm_add_epi32( v_s2, _mm_slli_epi32( v_ps, 5 ) );
+        sum1 += __hexin_adler32_hsum128( v_s1 );
+        sum2  = __hexin_adler32_hsum128( v_s2 );
+        sum1 %= HEXIN_ADLER32_BASE;
+        sum2 %= HEXIN_ADLER32_BASE;
+    }
+
+    return __hexin_adler32_scalar( pSrc, len, ( sum2 << 16 ) | sum1 );
+}
+
+HEXIN_TARGET( "avx2" )
+static unsigned int __hexin_adler32_hsum256( __m256i v )
+{
+    __m128i x = _mm_add_epi32( _mm256_castsi256_si128( v ), _mm256_extracti128_si256( v, 1 ) );
+
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    return ( unsigned int )_mm_cvtsi128_si32( x );
+}
+
+HEXIN_TARGET( "avx2" )
+static unsigned int __hexin_adler32_avx2( const unsigned char *pSrc, size_t len, unsigned int adler )
+{
+    unsigned int sum1 = adler & 0xFFFF;
+    unsigned int sum2 = ( adler >> 16 ) & 0xFFFF;
+    size_t blocks = len / HEXIN_ADLER32_BLOCK;
+    size_t n = 0;
+
+    const __m256i tap  = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                           16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16( 1 );
+
+    len -= blocks * HEXIN_ADLER32_BLOCK;
+    while ( blocks ) {
+        __m256i v_ps = zero, v_s1 = zero, v_s2 = zero;
+
+        n = HEXIN_ADLER32_NMAX / HEXIN_ADLER32_BLOCK;
+        if ( n > blocks ) {
+            n = blocks;
+        }
+        blocks -= n;
+        v_ps = _mm256_setr_epi32( ( int )( sum1 * n ), 0, 0, 0, 0, 0, 0, 0 );
+        v_s2 = _mm256_setr_epi32( ( int )sum2, 0, 0, 0, 0, 0, 0, 0 );
+
+        do {
+            const __m256i bytes = _mm256_loadu_si256( ( const __m256i * )pSrc );
+
+            v_ps = _mm256_add_epi32( v_ps, v_s1 );
+            v_s1 = _mm256_add_epi32( v_s1, _mm256_sad_epu8( bytes, zero ) );
+            v_s2 = _mm256_add_epi32( v_s2, _mm256_madd_epi16( _mm256_maddubs_epi16( bytes, tap ), ones ) );
+            pSrc += HEXIN_ADLER32_BLOCK;
+        } while ( --n );
+
+        v_s2  = _mm256_add_epi32( v_s2, _mm256_slli_epi32( v_ps, 5 ) );
+        sum1 += __hexin_adler32_hsum256( v_s1 );
+        sum2  = __hexin_adler32_hsum256( v_s2 );
+        sum1 %= HEXIN_ADLER32_BASE;
+        sum2 %= HEXIN_ADLER32_BASE;
+    }
+
+    _mm256_zeroupper();
+    return __hexin_adler32_scalar( pSrc, len, ( sum2 << 16 ) | sum1 );
+}
+
+#endif /* HEXIN_X86_64 */
+
+unsigned int hexin_adler32_compute( const unsigned char *pSrc, size_t len, unsigned int adler )
+{
+#if defined( HEXIN_X86_64 )
+    unsigned int features = 0;
+#endif /* HEXIN_X86_64 */
+
+    /* zlib reduces both halves of the value, for no data too. */
+    adler = ( ( ( adler >> 16 ) % HEXIN_ADLER32_BASE ) << 16 ) | ( ( adler & 0xFFFF ) % HEXIN_ADLER32_BASE );
+
+#if defined( HEXIN_X86_64 )
+    if ( len >= HEXIN_ADLER32_BLOCK ) {
+        features = hexin_cpu_features();
+        if ( features & HEXIN_CPU_AVX2 ) {
+            return __hexin_adler32_avx2( pSrc, len, adler );
+        }
+        if ( features & HEXIN_CPU_SSSE3 ) {
+            return __hexin_adler32_ssse3( pSrc, len, adler );
+        }
+    }
+#endif /* HEXIN_X86_64 */
+    return __hexin_adler32_scalar( pSrc, len, adler );
+}
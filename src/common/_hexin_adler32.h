@@ -0,0 +1,31 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_adler32.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-06 [Heyn] Initialize.
+*                       Adler-32 reduced once per NMAX bytes, SSSE3 / AVX2 kernels.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_ADLER32_H__
+#define __HEXIN_ADLER32_H__
+
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_ADLER32_BASE                      65521           /* Largest prime smaller than 65536 */
+#define                 HEXIN_ADLER32_NMAX                      5552            /* Largest n, 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1 */
+#define                 HEXIN_ADLER32_BLOCK                     32              /* Bytes per step of the SIMD kernels */
+
+/*
+ * adler : the value of the data before ( 1 to start ), as zlib.adler32( data, value ).
+ */
+unsigned int hexin_adler32_compute( const unsigned char *pSrc, size_t len, unsigned int adler );
+
+#endif //__HEXIN_ADLER32_H__
@@ -0,0 +1,134 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_batch.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-03 [Heyn] Initialize.
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_hexin_batch.h"
+
+static int hexin_batch_buffers( struct _hexin_batch *batch, PyObject *data )
+{
+    Py_ssize_t i = 0;
+    PyObject *seq = PySequence_Fast( data, "data must be a sequence of bytes-like objects ( or one with offsets )" );
+
+    if ( seq == NULL ) {
+        return 0;
+    }
+
+    batch->count = PySequence_Fast_GET_SIZE( seq );
+    batch->pSrc  = PyMem_Malloc( sizeof( const unsigned char * ) * ( batch->count + 1 ) );
+    batch->len   = PyMem_Malloc( sizeof( size_t ) * ( batch->count + 1 ) );
+    batch->views = PyMem_Malloc( sizeof( Py_buffer ) * ( batch->count + 1 ) );
+    if ( ( batch->pSrc == NULL ) || ( batch->len == NULL ) || ( batch->views == NULL ) ) {
+        Py_DECREF( seq );
+        PyErr_NoMemory();
+        return 0;
+    }
+
+    for ( i=0; i<batch->count; i++ ) {
+        if ( PyObject_GetBuffer( PySequence_Fast_GET_ITEM( seq, i ), &batch->views[i], PyBUF_SIMPLE ) != 0 ) {
+            Py_DECREF( seq );
+            return 0;
+        }
+        batch->acquired++;
+        batch->pSrc[i] = ( const unsigned char * )batch->views[i].buf;
+        batch->len[i]  = ( size_t )batch->views[i].len;
+        batch->total  += ( size_t )batch->views[i].len;
+    }
+
+    Py_DECREF( seq );
+    return 1;
+}
+
+static int hexin_batch_offsets( struct _hexin_batch *batch, PyObject *data, PyObject *offsets )
+{
+    Py_ssize_t i = 0, size = 0, start = 0, end = 0;
+    PyObject *seq = NULL;
+
+    if ( PyObject_GetBuffer( data, &batch->data, PyBUF_SIMPLE ) != 0 ) {
+        return 0;
+    }
+
+    seq = PySequence_Fast( offsets, "offsets must be a sequence of integers" );
+    if ( seq == NULL ) {
+        return 0;
+    }
+
+    size         = PySequence_Fast_GET_SIZE( seq );
+    batch->count = ( size > 0 ) ? ( size - 1 ) : 0;
+    batch->pSrc  = PyMem_Malloc( sizeof( const unsigned char * ) * ( batch->count + 1 ) );
+    batch->len   = PyMem_Malloc( sizeof( size_t ) * ( batch->count + 1 ) );
+    if ( ( batch->pSrc == NULL ) || ( batch->len == NULL ) ) {
+        Py_DECREF( seq );
+        PyErr_NoMemory();
+        return 0;
+    }
+
+    for ( i=0; i<size; i++ ) {
+        end = PyNumber_AsSsize_t( PySequence_Fast_GET_ITEM( seq, i ), PyExc_OverflowError );
+        if ( ( end == -1 ) && PyErr_Occurred() ) {
+            Py_DECREF( seq );
+            return 0;
+        }
+        if ( ( end < start ) || ( end > batch->data.len ) ) {
+            PyErr_Format( PyExc_ValueError, "offsets[%zd] = %zd, offsets must be increasing and within data ( %zd bytes )",
+                          i, end, batch->data.len );
+            Py_DECREF( seq );
+            return 0;
+        }
+        if ( i > 0 ) {
+            batch->pSrc[i - 1] = ( const unsigned char * )batch->data.buf + start;
+            batch->len[i - 1]  = ( size_t )( end - start );
+            batch->total      += ( size_t )( end - start );
+        }
+        start = end;
+    }
+
+    Py_DECREF( seq );
+    return 1;
+}
+
+int hexin_batch_acquire( struct _hexin_batch *batch, PyObject *data, PyObject *offsets )
+{
+    int ok = 0;
+
+    memset( batch, 0, sizeof( struct _hexin_batch ) );
+
+    if ( ( offsets == NULL ) || ( offsets == Py_None ) ) {
+        ok = hexin_batch_buffers( batch, data );
+    } else {
+        ok = hexin_batch_offsets( batch, data, offsets );
+    }
+
+    if ( !ok ) {
+        hexin_batch_release( batch );
+    }
+    return ok;
+}
+
+void hexin_batch_release( struct _hexin_batch *batch )
+{
+    Py_ssize_t i = 0;
+
+    for ( i=0; i<batch->acquired; i++ ) {
+        PyBuffer_Release( &batch->views[i] );
+    }
+    if ( batch->data.obj ) {
+        PyBuffer_Release( &batch->data );
+    }
+
+    PyMem_Free( batch->views );
+    PyMem_Free( batch->pSrc );
+    PyMem_Free( batch->len );
+    memset( batch, 0, sizeof( struct _hexin_batch ) );
+}
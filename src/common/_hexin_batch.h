@@ -0,0 +1,41 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_batch.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-03 [Heyn] Initialize.
+*                       Frames of the _xxx_batch() calls, a sequence of buffers or one buffer cut by offsets.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_BATCH_H__
+#define __HEXIN_BATCH_H__
+
+#include <Python.h>
+
+struct _hexin_batch {
+    Py_ssize_t                  count;          /* Frames */
+    size_t                      total;          /* Bytes of all the frames */
+    const unsigned char       **pSrc;           /* Frame i is pSrc[i], len[i] bytes */
+    size_t                     *len;
+    Py_buffer                  *views;          /* Sequence of buffers, one view per frame */
+    Py_ssize_t                  acquired;
+    Py_buffer                   data;           /* One buffer cut by offsets */
+};
+
+/*
+ * offsets == NULL or None : data is a sequence of bytes-like objects, one frame each.
+ * otherwise               : frame i is data[ offsets[i]:offsets[i + 1] ], offsets holds count + 1 increasing positions.
+ * Called with the GIL, the frames stay valid without it until hexin_batch_release().
+ * Returns 0 with a Python exception set on failure, nothing to release then.
+ */
+int  hexin_batch_acquire( struct _hexin_batch *batch, PyObject *data, PyObject *offsets );
+void hexin_batch_release( struct _hexin_batch *batch );
+
+#endif //__HEXIN_BATCH_H__
@@ -0,0 +1,107 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_cache.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-10 [Heyn] Initialize.
+*                       2022-06-15 [Heyn] New add hexin_cache_release(), pinned entries are skipped by the eviction.
+*                       2022-06-15 [Heyn] New add hexin_cache_built(), a new entry is not built until the caller filled it.
+*
+*********************************************************************************************************
+*/
+
+#include <stdlib.h>
+#include "_hexin_cache.h"
+
+void *hexin_cache_lookup( struct _hexin_cache *cache, unsigned int width, unsigned long long poly, unsigned long long poly_hi,
+                          unsigned int refin, unsigned int refout, size_t size, unsigned int rebuild, unsigned int *is_built )
+{
+    unsigned int i = 0;
+    struct _hexin_cache_entry *entry = NULL, *victim = NULL;
+
+    cache->tick++;
+    for ( i=0; i<HEXIN_CACHE_ENTRIES; i++ ) {
+        entry = &cache->entry[i];
+        if ( entry->used == 0 ) {
+            victim = entry;             /* Entries are filled in order, no model after a free one */
+            break;
+        }
+        if ( ( entry->poly == poly ) && ( entry->poly_hi == poly_hi ) && ( entry->width == width ) &&
+             ( entry->refin == refin ) && ( entry->refout == refout ) ) {
+            /* The holders compute on the tables without the GIL, rebuild them only when there is none. */
+            if ( ( rebuild != 0 ) && ( entry->pins == 0 ) ) {
+                entry->is_built = 0;
+            }
+            *is_built   = entry->is_built;
+            entry->used = cache->tick;
+            entry->pins++;
+            return entry->tables;
+        }
+        if ( ( entry->pins == 0 ) && ( ( victim == NULL ) || ( entry->used < victim->used ) ) ) {
+            victim = entry;
+        }
+    }
+
+    *is_built = 0;
+    if ( victim == NULL ) {
+        return malloc( size );          /* All pinned, private storage */
+    }
+
+    if ( victim->tables == NULL ) {
+        victim->tables = malloc( size );
+        if ( victim->tables == NULL ) {
+            return NULL;
+        }
+    }
+    victim->width   = width;
+    victim->poly    = poly;
+    victim->poly_hi = poly_hi;
+    victim->refin   = refin;
+    victim->refout  = refout;
+    victim->used    = cache->tick;
+    victim->pins    = 1;
+    victim->is_built = 0;
+    return victim->tables;
+}
+
+static struct _hexin_cache_entry *hexin_cache_entry( struct _hexin_cache *cache, void *tables )
+{
+    unsigned int i = 0;
+
+    for ( i=0; ( i<HEXIN_CACHE_ENTRIES ) && ( cache->entry[i].used != 0 ); i++ ) {
+        if ( cache->entry[i].tables == tables ) {
+            return &cache->entry[i];
+        }
+    }
+    return NULL;                        /* Private storage of hexin_cache_lookup() */
+}
+
+void hexin_cache_built( struct _hexin_cache *cache, void *tables )
+{
+    struct _hexin_cache_entry *entry = hexin_cache_entry( cache, tables );
+
+    if ( entry != NULL ) {
+        entry->is_built = 1;
+    }
+}
+
+void hexin_cache_release( struct _hexin_cache *cache, void *tables )
+{
+    struct _hexin_cache_entry *entry = NULL;
+
+    if ( tables == NULL ) {
+        return;
+    }
+
+    entry = hexin_cache_entry( cache, tables );
+    if ( entry != NULL ) {
+        entry->pins--;
+    } else {
+        free( tables );                 /* Private storage of hexin_cache_lookup() */
+    }
+}
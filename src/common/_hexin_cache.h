@@ -0,0 +1,61 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_cache.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-10 [Heyn] Initialize.
+*                       LRU cache of the hacker*() tables, keyed on ( width, poly, refin, refout ).
+*                       2022-06-15 [Heyn] Entries are pinned until hexin_cache_release(), never evicted or rebuilt under a holder.
+*                       2022-06-15 [Heyn] An entry is built only after hexin_cache_built(), a failed build leaves it to the next lookup.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_CACHE_H__
+#define __HEXIN_CACHE_H__
+
+#include <stddef.h>
+
+#define                 HEXIN_CACHE_ENTRIES                     64
+
+struct _hexin_cache_entry {
+    unsigned int        width;
+    unsigned long long  poly;
+    unsigned long long  poly_hi;            /* Bits 64 .. of poly ( crc82 ), else 0 */
+    unsigned int        refin;
+    unsigned int        refout;
+    unsigned long long  used;               /* Tick of the last lookup, 0 : free entry */
+    unsigned int        pins;               /* Lookups not released yet, the entry is not evicted or rebuilt while > 0 */
+    unsigned int        is_built;           /* Set by hexin_cache_built(), the tables are filled */
+    void               *tables;
+};
+
+/* One per hacker function, zero initialized ( static ). */
+struct _hexin_cache {
+    unsigned long long          tick;
+    struct _hexin_cache_entry   entry[HEXIN_CACHE_ENTRIES];
+};
+
+/*
+ * Storage of size bytes for the tables of the model, *is_built is 1 when an earlier call built them ( hexin_cache_built() ),
+ * 0 when the caller has to build them and then call hexin_cache_built() ( new model, the storage of the least recently used one,
+ * an earlier build that failed, or rebuild and no other holder ).
+ * The storage is pinned : it stays valid ( also without the GIL ) until the caller passes it to hexin_cache_release().
+ * When all the entries are pinned the storage is a private one, freed by hexin_cache_release().
+ * Called with the GIL. Returns NULL when out of memory.
+ */
+void *hexin_cache_lookup( struct _hexin_cache *cache, unsigned int width, unsigned long long poly, unsigned long long poly_hi,
+                          unsigned int refin, unsigned int refout, size_t size, unsigned int rebuild, unsigned int *is_built );
+
+/* Marks the tables of hexin_cache_lookup() built, once the caller filled them. Called with the GIL. */
+void hexin_cache_built( struct _hexin_cache *cache, void *tables );
+
+/* Unpins the tables of hexin_cache_lookup(), called with the GIL. */
+void hexin_cache_release( struct _hexin_cache *cache, void *tables );
+
+#endif //__HEXIN_CACHE_H__
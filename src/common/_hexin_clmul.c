@@ -0,0 +1,292 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_clmul.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-16 [Heyn] Initialize.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-14 [Heyn] New add the AVX-512 VPCLMULQDQ kernel, 4 x 128-bit lanes per register.
+*
+*********************************************************************************************************
+*/
+
+#include "_hexin_clmul.h"
+
+#if defined( HEXIN_X86_64 )
+#include <immintrin.h>
+#endif /* HEXIN_X86_64 */
+
+/* VPCLMULQDQ needs GCC 8, clang 6 or MSVC 2019 */
+#if defined( HEXIN_X86_64 ) && ( ( defined( __clang__ ) && ( __clang_major__ >= 6 ) ) ||                                     \
+                                 ( !defined( __clang__ ) && defined( __GNUC__ ) && ( __GNUC__ >= 8 ) ) ||                   \
+                                 ( defined( _MSC_VER ) && ( _MSC_VER >= 1920 ) ) )
+#define                 HEXIN_CLMUL_AVX512                      1
+#endif
+
+static unsigned long long __hexin_reflect64( unsigned long long data )
+{
+    data = ( ( data >>  1 ) & 0x5555555555555555ULL ) | ( ( data & 0x5555555555555555ULL ) <<  1 );
+    data = ( ( data >>  2 ) & 0x3333333333333333ULL ) | ( ( data & 0x3333333333333333ULL ) <<  2 );
+    data = ( ( data >>  4 ) & 0x0F0F0F0F0F0F0F0FULL ) | ( ( data & 0x0F0F0F0F0F0F0F0FULL ) <<  4 );
+    data = ( ( data >>  8 ) & 0x00FF00FF00FF00FFULL ) | ( ( data & 0x00FF00FF00FF00FFULL ) <<  8 );
+    data = ( ( data >> 16 ) & 0x0000FFFF0000FFFFULL ) | ( ( data & 0x0000FFFF0000FFFFULL ) << 16 );
+    return ( data >> 32 ) | ( data << 32 );
+}
+
+/*
+ * x^n mod P, P(x) = x^64 + poly.
+ */
+static unsigned long long __hexin_xpow_mod( unsigned int n, unsigned long long poly )
+{
+    unsigned long long r = 1;
+
+    while ( n-- ) {
+        r = ( r & 0x8000000000000000ULL ) ? ( ( r << 1 ) ^ poly ) : ( r << 1 );
+    }
+    return r;
+}
+
+/*
+ * floor( x^128 / P ) without the x^64 term.
+ */
+static unsigned long long __hexin_barrett_mu( unsigned long long poly )
+{
+    unsigned long long r = poly;        /* x^64 mod P */
+    unsigned long long q = 0;
+    unsigned int i = 0;
+
+    for ( i=0; i<64; i++ ) {
+        q <<= 1;
+        if ( r & 0x8000000000000000ULL ) {
+            q |= 1;
+            r = ( r << 1 ) ^ poly;
+        } else {
+            r <<= 1;
+        }
+    }
+    return q;
+}
+
+/*
+ * Reflected lanes multiply one bit too high, so x^n is stored as x^(n-1).
+ */
+static void __hexin_fold_constant( unsigned long long k[2], unsigned int n, unsigned long long poly, unsigned int reflected )
+{
+    if ( reflected ) {
+        k[0] = __hexin_reflect64( __hexin_xpow_mod( n + 64 - 1, poly ) );
+        k[1] = __hexin_reflect64( __hexin_xpow_mod( n - 1,      poly ) );
+    } else {
+        k[0] = __hexin_xpow_mod( n,      poly );
+        k[1] = __hexin_xpow_mod( n + 64, poly );
+    }
+}
+
+void hexin_clmul_init( struct _hexin_clmul *clmul, unsigned long long poly, unsigned int reflected )
+{
+    unsigned long long mu = __hexin_barrett_mu( poly );
+
+    clmul->reflected = reflected;
+    clmul->poly      = poly;
+    __hexin_fold_constant( clmul->fold2048, 2048, poly, reflected );
+    __hexin_fold_constant( clmul->fold512,   512, poly, reflected );
+    __hexin_fold_constant( clmul->fold128,   128, poly, reflected );
+    clmul->barrett[0] = reflected ? __hexin_reflect64( mu   ) : mu;
+    clmul->barrett[1] = reflected ? __hexin_reflect64( poly ) : poly;
+}
+
+unsigned int hexin_clmul_is_supported( void )
+{
+    unsigned int required = HEXIN_CPU_SSSE3 | HEXIN_CPU_PCLMUL;
+    return ( ( hexin_cpu_features() & required ) == required );
+}
+
+/* The kernel of hexin_clmul_compute() for the buffers of HEXIN_CLMUL_AVX512_LENGTH and more. */
+unsigned int hexin_clmul_kernel( void )
+{
+#if defined( HEXIN_CLMUL_AVX512 )
+    unsigned int required = HEXIN_CPU_SSSE3 | HEXIN_CPU_PCLMUL | HEXIN_CPU_AVX512 | HEXIN_CPU_VPCLMUL;
+    if ( ( hexin_cpu_features() & required ) == required ) {
+        return HEXIN_KERNEL_AVX512;
+    }
+#endif /* HEXIN_CLMUL_AVX512 */
+    return HEXIN_KERNEL_PCLMUL;
+}
+
+#if defined( HEXIN_X86_64 )
+
+#define __HEXIN_CLMUL_TARGET    HEXIN_TARGET( "sse2,ssse3,pclmul" )
+
+static __HEXIN_CLMUL_TARGET __m128i __hexin_fold( __m128i x, __m128i k, __m128i data )
+{
+    __m128i lo = _mm_clmulepi64_si128( x, k, 0x00 );
+    __m128i hi = _mm_clmulepi64_si128( x, k, 0x11 );
+    return _mm_xor_si128( _mm_xor_si128( lo, hi ), data );
+}
+
+static __HEXIN_CLMUL_TARGET unsigned long long __hexin_hi64( __m128i x )
+{
+    return ( unsigned long long )_mm_cvtsi128_si64( _mm_unpackhi_epi64( x, x ) );
+}
+
+static __HEXIN_CLMUL_TARGET unsigned long long __hexin_lo64( __m128i x )
+{
+    return ( unsigned long long )_mm_cvtsi128_si64( x );
+}
+
+#if defined( HEXIN_CLMUL_AVX512 )
+
+#define __HEXIN_CLMUL_AVX512_TARGET     HEXIN_TARGET( "avx512f,avx512bw,avx512vl,pclmul,vpclmulqdq" )
+
+/* __hexin_fold() on the four 128-bit lanes of a register */
+static __HEXIN_CLMUL_AVX512_TARGET __m512i __hexin_fold4( __m512i x, __m512i k, __m512i data )
+{
+    __m512i lo = _mm512_clmulepi64_epi128( x, k, 0x00 );
+    __m512i hi = _mm512_clmulepi64_epi128( x, k, 0x11 );
+    return _mm512_ternarylogic_epi64( lo, hi, data, 0x96 );        /* lo ^ hi ^ data */
+}
+
+/* __hexin_fold() VEX encoded, the SSE one here would pay the SSE / AVX transitions. */
+static __HEXIN_CLMUL_AVX512_TARGET __m128i __hexin_fold1( __m128i x, __m128i k, __m128i data )
+{
+    __m128i lo = _mm_clmulepi64_si128( x, k, 0x00 );
+    __m128i hi = _mm_clmulepi64_si128( x, k, 0x11 );
+    return _mm_ternarylogic_epi64( lo, hi, data, 0x96 );
+}
+
+/*
+ * The 64-byte blocks of pSrc ( len >= HEXIN_CLMUL_AVX512_LENGTH ), four registers of four lanes,
+ * folded down to the one 128-bit lane the tail of hexin_clmul_compute() goes on with.
+ * crc : the register as the first lane of hexin_clmul_compute() takes it. *blocks : 16-byte blocks done.
+ */
+static __HEXIN_CLMUL_AVX512_TARGET __m128i __hexin_clmul_avx512( const unsigned char *pSrc, size_t len, __m128i crc,
+                                                                 const struct _hexin_clmul *clmul, size_t *blocks )
+{
+    const __m512i *p = ( const __m512i * )pSrc;
+    __m512i bswap    = _mm512_broadcast_i32x4( _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) );
+    __m512i k2048    = _mm512_broadcast_i32x4( _mm_set_epi64x( ( long long )clmul->fold2048[1], ( long long )clmul->fold2048[0] ) );
+    __m512i k512     = _mm512_broadcast_i32x4( _mm_set_epi64x( ( long long )clmul->fold512[1],  ( long long )clmul->fold512[0] ) );
+    __m128i k128     = _mm_set_epi64x( ( long long )clmul->fold128[1], ( long long )clmul->fold128[0] );
+    __m512i y0, y1, y2, y3;
+    __m128i x;
+    size_t i = 0, n = len / 64;
+
+#define __HEXIN_LOAD4(i)    ( clmul->reflected ? _mm512_loadu_si512( p + (i) ) : _mm512_shuffle_epi8( _mm512_loadu_si512( p + (i) ), bswap ) )
+
+    y0 = _mm512_xor_si512( __HEXIN_LOAD4( 0 ), _mm512_inserti32x4( _mm512_setzero_si512(), crc, 0 ) );
+    y1 = __HEXIN_LOAD4( 1 );
+    y2 = __HEXIN_LOAD4( 2 );
+    y3 = __HEXIN_LOAD4( 3 );
+
+    for ( i=4; i+4<=n; i+=4 ) {
+        y0 = __hexin_fold4( y0, k2048, __HEXIN_LOAD4( i + 0 ) );
+        y1 = __hexin_fold4( y1, k2048, __HEXIN_LOAD4( i + 1 ) );
+        y2 = __hexin_fold4( y2, k2048, __HEXIN_LOAD4( i + 2 ) );
+        y3 = __hexin_fold4( y3, k2048, __HEXIN_LOAD4( i + 3 ) );
+    }
+
+    y0 = __hexin_fold4( y0, k512, y1 );
+    y0 = __hexin_fold4( y0, k512, y2 );
+    y0 = __hexin_fold4( y0, k512, y3 );
+    for ( ; i<n; i++ ) {
+        y0 = __hexin_fold4( y0, k512, __HEXIN_LOAD4( i ) );
+    }
+
+#undef __HEXIN_LOAD4
+
+    /* Lane 0 holds the earliest bytes, each lane is 128 bits before the next one. */
+    x = __hexin_fold1( _mm512_castsi512_si128( y0 ), k128, _mm512_extracti32x4_epi32( y0, 1 ) );
+    x = __hexin_fold1( x, k128, _mm512_extracti32x4_epi32( y0, 2 ) );
+    x = __hexin_fold1( x, k128, _mm512_extracti32x4_epi32( y0, 3 ) );
+
+    *blocks = n * 4;
+    return x;
+}
+
+#endif /* HEXIN_CLMUL_AVX512 */
+
+/*
+ * len : multiple of 16 and not less than HEXIN_CLMUL_MIN_LENGTH.
+ * Returns the register after the whole buffer has been shifted through it.
+ */
+__HEXIN_CLMUL_TARGET
+unsigned long long hexin_clmul_compute( const unsigned char *pSrc, size_t len, unsigned long long crc, const struct _hexin_clmul *clmul )
+{
+    const __m128i *p = ( const __m128i * )pSrc;
+    __m128i bswap    = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+    __m128i k512     = _mm_set_epi64x( ( long long )clmul->fold512[1], ( long long )clmul->fold512[0] );
+    __m128i k128     = _mm_set_epi64x( ( long long )clmul->fold128[1], ( long long )clmul->fold128[0] );
+    __m128i mu       = _mm_cvtsi64_si128( ( long long )clmul->barrett[0] );
+    __m128i poly     = _mm_cvtsi64_si128( ( long long )clmul->barrett[1] );
+    __m128i first    = clmul->reflected ? _mm_cvtsi64_si128( ( long long )crc ) : _mm_set_epi64x( ( long long )crc, 0 );
+    __m128i x0, x1, x2, x3, z, q;
+    unsigned long long a = 0, b = 0;
+    size_t i = 0, n = len / 16;
+
+#define __HEXIN_LOAD(i)     ( clmul->reflected ? _mm_loadu_si128( p + (i) ) : _mm_shuffle_epi8( _mm_loadu_si128( p + (i) ), bswap ) )
+
+#if defined( HEXIN_CLMUL_AVX512 )
+    if ( ( len >= HEXIN_CLMUL_AVX512_LENGTH ) && ( hexin_clmul_kernel() == HEXIN_KERNEL_AVX512 ) ) {
+        x0 = __hexin_clmul_avx512( pSrc, len, first, clmul, &i );
+    } else
+#endif /* HEXIN_CLMUL_AVX512 */
+    {
+        x0 = _mm_xor_si128( __HEXIN_LOAD( 0 ), first );
+        x1 = __HEXIN_LOAD( 1 );
+        x2 = __HEXIN_LOAD( 2 );
+        x3 = __HEXIN_LOAD( 3 );
+
+        for ( i=4; i+4<=n; i+=4 ) {
+            x0 = __hexin_fold( x0, k512, __HEXIN_LOAD( i + 0 ) );
+            x1 = __hexin_fold( x1, k512, __HEXIN_LOAD( i + 1 ) );
+            x2 = __hexin_fold( x2, k512, __HEXIN_LOAD( i + 2 ) );
+            x3 = __hexin_fold( x3, k512, __HEXIN_LOAD( i + 3 ) );
+        }
+
+        x0 = __hexin_fold( x0, k128, x1 );
+        x0 = __hexin_fold( x0, k128, x2 );
+        x0 = __hexin_fold( x0, k128, x3 );
+    }
+
+    for ( ; i<n; i++ ) {
+        x0 = __hexin_fold( x0, k128, __HEXIN_LOAD( i ) );
+    }
+
+#undef __HEXIN_LOAD
+
+    /* x0 * x^64 mod P : fold the high-order half down, then Barrett reduction. */
+    if ( clmul->reflected ) {
+        z = _mm_xor_si128( _mm_clmulepi64_si128( x0, k128, 0x10 ), _mm_srli_si128( x0, 8 ) );
+        a = __hexin_lo64( z );
+        b = __hexin_hi64( z );
+        q = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )a ), mu, 0x00 );
+        a = a ^ ( __hexin_lo64( q ) << 1 );
+        q = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )a ), poly, 0x00 );
+        return b ^ ( __hexin_hi64( q ) << 1 ) ^ ( __hexin_lo64( q ) >> 63 );
+    }
+
+    z = _mm_xor_si128( _mm_clmulepi64_si128( x0, k128, 0x01 ), _mm_slli_si128( x0, 8 ) );
+    a = __hexin_hi64( z );
+    b = __hexin_lo64( z );
+    q = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )a ), mu, 0x00 );
+    a = a ^ __hexin_hi64( q );
+    q = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )a ), poly, 0x00 );
+    return b ^ __hexin_lo64( q );
+}
+
+#else
+
+unsigned long long hexin_clmul_compute( const unsigned char *pSrc, size_t len, unsigned long long crc, const struct _hexin_clmul *clmul )
+{
+    /* Never selected, hexin_clmul_is_supported() is always FALSE here. */
+    ( void )pSrc;
+    ( void )len;
+    ( void )clmul;
+    return crc;
+}
+
+#endif /* HEXIN_X86_64 */
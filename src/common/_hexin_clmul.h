@@ -0,0 +1,46 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_clmul.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-16 [Heyn] Initialize.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-14 [Heyn] New add the AVX-512 VPCLMULQDQ kernel ( fold2048, hexin_clmul_kernel ).
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_CLMUL_H__
+#define __HEXIN_CLMUL_H__
+
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_CLMUL_MIN_LENGTH                  64
+#define                 HEXIN_CLMUL_AVX512_LENGTH               512             /* 4 x 64 bytes per loop, shorter ones stay on PCLMULQDQ */
+
+/*
+ * Folding constants for a 64-bit register CRC, P(x) = x^64 + poly.
+ * Narrower CRCs are folded as 64-bit ones:
+ *   MSB first  : poly = ( poly << ( 64 - width ) ), register = ( crc << ( 64 - width ) )
+ *   Reflected  : poly as above, register = reflected crc (zero extended)
+ */
+struct _hexin_clmul {
+    unsigned int        reflected;
+    unsigned long long  poly;
+    unsigned long long  fold2048[2];                                /* x^2048 / x^2112 mod P ( AVX-512, 4 x 512 bits ) */
+    unsigned long long  fold512[2];                                 /* x^512 / x^576 mod P */
+    unsigned long long  fold128[2];                                 /* x^128 / x^192 mod P */
+    unsigned long long  barrett[2];                                 /* floor( x^128 / P ), P */
+};
+
+unsigned int hexin_clmul_is_supported( void );
+unsigned int hexin_clmul_kernel( void );                            /* HEXIN_KERNEL_PCLMUL or HEXIN_KERNEL_AVX512 */
+void hexin_clmul_init( struct _hexin_clmul *clmul, unsigned long long poly, unsigned int reflected );
+unsigned long long hexin_clmul_compute( const unsigned char *pSrc, size_t len, unsigned long long crc, const struct _hexin_clmul *clmul );
+
+#endif //__HEXIN_CLMUL_H__
@@ -0,0 +1,122 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_core.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-12 [Heyn] Initialize.
+*                       The CRC engine of crc8, crc16, crc24, crc32, crc64, crcx and canx, one instance per module :
+*
+*                           #define HEXIN_CORE_NAME     crc16               hexin_crc16_xxx(), struct _hexin_crc16
+*                           #define HEXIN_CORE_TYPE     unsigned short      The register
+*                           #define HEXIN_CORE_BITS     16                  Bits of the register, widths 3 .. BITS run in it
+*                           #include "_hexin_core.h"
+*
+*                       _<module>tables.c defines HEXIN_CORE_IMPLEMENTATION before, for the functions ( _hexin_coreimpl.h ).
+*                       2022-06-13 [Heyn] New add hexin_xxx_compute_kernel(), the kernel a model runs ( HEXIN_KERNEL_XXX ).
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_CORE_H__
+#define __HEXIN_CORE_H__
+
+#include <stddef.h>
+#include "_hexin_clmul.h"
+
+#ifndef TRUE
+#define                 TRUE                                    1
+#endif
+
+#ifndef FALSE
+#define                 FALSE                                   0
+#endif
+
+#ifndef MAX_TABLE_ARRAY
+#define                 MAX_TABLE_ARRAY                         256
+#endif
+
+#ifndef HEXIN_REFIN_IS_TRUE
+#define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
+#define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
+#endif
+
+#ifndef HEXIN_GRADUAL_CALCULATE_IS_TRUE
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
+#endif
+
+#define                 HEXIN_CORE_SLICING                      8       /* Rows of the tables, slicing-by-8 */
+#define                 HEXIN_CORE_LANES                        4       /* Frames hashed in lockstep by hexin_xxx_compute_multi() */
+#define                 HEXIN_CORE_COMBINE_POWERS               64
+
+#define                 HEXIN_CORE_PASTE( a, b, c )             a ## b ## c
+#define                 HEXIN_CORE_XPASTE( a, b, c )            HEXIN_CORE_PASTE( a, b, c )
+#define                 HEXIN_CORE_FN( suffix )                 HEXIN_CORE_XPASTE( hexin_, HEXIN_CORE_NAME, suffix )
+#define                 HEXIN_CORE_PARAM                        HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, )
+#define                 HEXIN_CORE_TABLES                       HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, _tables )
+#define                 HEXIN_CORE_COMBINE                      HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, _combine )
+
+#endif //__HEXIN_CORE_H__
+
+#if !defined( HEXIN_CORE_NAME ) || !defined( HEXIN_CORE_TYPE ) || !defined( HEXIN_CORE_BITS )
+#error "_hexin_core.h needs HEXIN_CORE_NAME, HEXIN_CORE_TYPE and HEXIN_CORE_BITS"
+#endif
+
+/*
+ * Descriptor of a model. Built-in ones point at the generated tables ( src/gentables.py ),
+ * the others at a struct _hexin_xxx_tables filled by hexin_xxx_compute_init().
+ */
+struct HEXIN_CORE_PARAM {
+    unsigned int  is_initial;
+    unsigned int  width;
+    HEXIN_CORE_TYPE  poly;
+    HEXIN_CORE_TYPE  init;
+    unsigned int  refin;
+    unsigned int  refout;
+    HEXIN_CORE_TYPE  xorout;
+    const HEXIN_CORE_TYPE (*table)[MAX_TABLE_ARRAY];               /* table[0] is the classic byte table */
+    const struct _hexin_clmul *clmul;
+};
+
+/* Storage of the tables built at runtime ( hacker ), the built-in models use the generated ones. */
+struct HEXIN_CORE_TABLES {
+    HEXIN_CORE_TYPE  table[HEXIN_CORE_SLICING][MAX_TABLE_ARRAY];
+    struct _hexin_clmul clmul;
+};
+
+struct HEXIN_CORE_COMBINE {
+    HEXIN_CORE_TYPE empty;                 /* CRC of no data */
+    HEXIN_CORE_TYPE power[HEXIN_CORE_COMBINE_POWERS][HEXIN_CORE_BITS];  /* power[k] : 2^k zero bytes, one column per CRC bit */
+};
+
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _reverse )( HEXIN_CORE_TYPE data );
+
+unsigned int HEXIN_CORE_FN( _init_table_poly_is_high )( HEXIN_CORE_TYPE polynomial, HEXIN_CORE_TYPE *table );
+unsigned int HEXIN_CORE_FN( _init_table_poly_is_low  )( HEXIN_CORE_TYPE polynomial, HEXIN_CORE_TYPE *table );
+
+unsigned int    HEXIN_CORE_FN( _compute_init   )( struct HEXIN_CORE_PARAM *param, struct HEXIN_CORE_TABLES *tables );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_start  )( const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init, unsigned int is_gradual );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_update )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE crc );
+unsigned int    HEXIN_CORE_FN( _compute_kernel )( const struct HEXIN_CORE_PARAM *param );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_final  )( const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE crc );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute        )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init, unsigned int is_gradual );
+
+void HEXIN_CORE_FN( _combine_init )( const struct HEXIN_CORE_PARAM *param, struct HEXIN_CORE_COMBINE *combine );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _combine )( const struct HEXIN_CORE_COMBINE *combine, HEXIN_CORE_TYPE crc1, HEXIN_CORE_TYPE crc2, unsigned long long len2 );
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_parallel )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init,
+                                                    unsigned int is_gradual, unsigned int threads, unsigned int chunk );
+void HEXIN_CORE_FN( _compute_multi )( const unsigned char * const *pSrc, const size_t *len, size_t count,
+                                      const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE *result );
+
+#if defined( HEXIN_CORE_IMPLEMENTATION )
+#include "_hexin_coreimpl.h"
+#endif
+
+#undef HEXIN_CORE_NAME
+#undef HEXIN_CORE_TYPE
+#undef HEXIN_CORE_BITS
+#undef HEXIN_CORE_CRC32C
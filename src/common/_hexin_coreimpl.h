@@ -0,0 +1,502 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_coreimpl.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-12 [Heyn] Initialize ( was hexin_xxx_compute_xxx() of _crc8/16/24/32/64/x/canxtables.c ).
+*                       Functions of the engine declared by _hexin_core.h, included by it when HEXIN_CORE_IMPLEMENTATION is defined.
+*
+*                       The register is HEXIN_CORE_BITS wide, a narrower CRC runs in it as
+*                           refin == FALSE : crc << ( BITS - width ), poly << ( BITS - width )  ( aligned to the top bit )
+*                           refin == TRUE  : reflected crc in the low width bits, reflected poly
+*                       so the tables, slicing-by-8, PCLMULQDQ folding and lockstep kernels are the same for every width.
+*                       2022-06-13 [Heyn] The kernels follow hexin_cpu_features() ( LIBSCRC_KERNEL=scalar turns slicing-by-8 off ).
+*                       2022-06-14 [Heyn] CRC32C of the long buffers is folded by AVX-512 VPCLMULQDQ when the CPU has it.
+*
+*********************************************************************************************************
+*/
+
+#include <stdlib.h>
+#include "_hexin_pool.h"
+#if defined( HEXIN_CORE_CRC32C )
+#include "_hexin_crc32c.h"
+#endif
+
+#define                 HEXIN_CORE_SHIFT( x )                   ( HEXIN_CORE_BITS - (x)->width )
+#define                 HEXIN_CORE_MASK( x )                    ( ( HEXIN_CORE_TYPE )( ( HEXIN_CORE_TYPE )~( HEXIN_CORE_TYPE )0 >> HEXIN_CORE_SHIFT( x ) ) )
+#define                 HEXIN_CORE_TOP                          ( ( HEXIN_CORE_TYPE )( ( HEXIN_CORE_TYPE )1 << ( HEXIN_CORE_BITS - 1 ) ) )
+#define                 HEXIN_CORE_CLMUL_SHIFT                  ( 64 - HEXIN_CORE_BITS )
+
+/* One slicing-by-8 block of the register c, s moves on by HEXIN_CORE_SLICING bytes. */
+#define HEXIN_CORE_SLICE_HIGH( c, s, t )                                                                            \
+    do {                                                                                                            \
+        unsigned long long w = ( ( unsigned long long )s[0] <<  0 ) | ( ( unsigned long long )s[1] <<  8 ) |        \
+                               ( ( unsigned long long )s[2] << 16 ) | ( ( unsigned long long )s[3] << 24 ) |        \
+                               ( ( unsigned long long )s[4] << 32 ) | ( ( unsigned long long )s[5] << 40 ) |        \
+                               ( ( unsigned long long )s[6] << 48 ) | ( ( unsigned long long )s[7] << 56 );         \
+        w ^= ( unsigned long long )c;                                                                               \
+        c  = ( HEXIN_CORE_TYPE )( t[7][ ( w >>  0 ) & 0xFF ] ^ t[6][ ( w >>  8 ) & 0xFF ] ^                         \
+                                  t[5][ ( w >> 16 ) & 0xFF ] ^ t[4][ ( w >> 24 ) & 0xFF ] ^                         \
+                                  t[3][ ( w >> 32 ) & 0xFF ] ^ t[2][ ( w >> 40 ) & 0xFF ] ^                         \
+                                  t[1][ ( w >> 48 ) & 0xFF ] ^ t[0][ ( w >> 56 ) & 0xFF ] );                        \
+        s += HEXIN_CORE_SLICING;                                                                                    \
+    } while ( 0 )
+
+#define HEXIN_CORE_SLICE_LOW( c, s, t )                                                                             \
+    do {                                                                                                            \
+        unsigned long long w = ( ( unsigned long long )s[0] << 56 ) | ( ( unsigned long long )s[1] << 48 ) |        \
+                               ( ( unsigned long long )s[2] << 40 ) | ( ( unsigned long long )s[3] << 32 ) |        \
+                               ( ( unsigned long long )s[4] << 24 ) | ( ( unsigned long long )s[5] << 16 ) |        \
+                               ( ( unsigned long long )s[6] <<  8 ) | ( ( unsigned long long )s[7] <<  0 );         \
+        w ^= ( unsigned long long )c << HEXIN_CORE_CLMUL_SHIFT;                                                     \
+        c  = ( HEXIN_CORE_TYPE )( t[7][ ( w >> 56 ) & 0xFF ] ^ t[6][ ( w >> 48 ) & 0xFF ] ^                         \
+                                  t[5][ ( w >> 40 ) & 0xFF ] ^ t[4][ ( w >> 32 ) & 0xFF ] ^                         \
+                                  t[3][ ( w >> 24 ) & 0xFF ] ^ t[2][ ( w >> 16 ) & 0xFF ] ^                         \
+                                  t[1][ ( w >>  8 ) & 0xFF ] ^ t[0][ ( w >>  0 ) & 0xFF ] );                        \
+        s += HEXIN_CORE_SLICING;                                                                                    \
+    } while ( 0 )
+
+/* One byte of the register c, the byte table only. */
+#define HEXIN_CORE_BYTE_HIGH( c, b, t )     ( c = ( HEXIN_CORE_TYPE )( ( c >> 8 ) ^ t[0][ ( c ^ (b) ) & 0xFF ] ) )
+#define HEXIN_CORE_BYTE_LOW( c, b, t )      ( c = ( HEXIN_CORE_TYPE )( ( c << 8 ) ^ t[0][ ( ( c >> ( HEXIN_CORE_BITS - 8 ) ) ^ (b) ) & 0xFF ] ) )
+
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _reverse )( HEXIN_CORE_TYPE data )
+{
+    unsigned long long value = ( unsigned long long )data;
+
+    value = ( ( value >>  1 ) & 0x5555555555555555ULL ) | ( ( value & 0x5555555555555555ULL ) <<  1 );
+    value = ( ( value >>  2 ) & 0x3333333333333333ULL ) | ( ( value & 0x3333333333333333ULL ) <<  2 );
+    value = ( ( value >>  4 ) & 0x0F0F0F0F0F0F0F0FULL ) | ( ( value & 0x0F0F0F0F0F0F0F0FULL ) <<  4 );
+    value = ( ( value >>  8 ) & 0x00FF00FF00FF00FFULL ) | ( ( value & 0x00FF00FF00FF00FFULL ) <<  8 );
+    value = ( ( value >> 16 ) & 0x0000FFFF0000FFFFULL ) | ( ( value & 0x0000FFFF0000FFFFULL ) << 16 );
+    value = ( ( value >> 32 ) & 0x00000000FFFFFFFFULL ) | ( ( value & 0x00000000FFFFFFFFULL ) << 32 );
+    return ( HEXIN_CORE_TYPE )( value >> HEXIN_CORE_CLMUL_SHIFT );
+}
+
+/* LSB-first byte table, polynomial is the reflected one. */
+unsigned int HEXIN_CORE_FN( _init_table_poly_is_high )( HEXIN_CORE_TYPE polynomial, HEXIN_CORE_TYPE *table )
+{
+    unsigned int i = 0, j = 0;
+    HEXIN_CORE_TYPE crc = 0;
+
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = ( HEXIN_CORE_TYPE )i;
+        for ( j=0; j<8; j++ ) {
+            if ( crc & 0x01 ) crc = ( HEXIN_CORE_TYPE )( ( crc >> 1 ) ^ polynomial );
+            else              crc = ( HEXIN_CORE_TYPE )(   crc >> 1 );
+        }
+        table[i] = crc;
+    }
+    return TRUE;
+}
+
+/* MSB-first byte table, polynomial is aligned to the top bit of the register. */
+unsigned int HEXIN_CORE_FN( _init_table_poly_is_low )( HEXIN_CORE_TYPE polynomial, HEXIN_CORE_TYPE *table )
+{
+    unsigned int i = 0, j = 0;
+    HEXIN_CORE_TYPE crc = 0;
+
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = ( HEXIN_CORE_TYPE )( ( HEXIN_CORE_TYPE )i << ( HEXIN_CORE_BITS - 8 ) );
+        for ( j=0; j<8; j++ ) {
+            if ( crc & HEXIN_CORE_TOP ) crc = ( HEXIN_CORE_TYPE )( ( crc << 1 ) ^ polynomial );
+            else                        crc = ( HEXIN_CORE_TYPE )(   crc << 1 );
+        }
+        table[i] = crc;
+    }
+    return TRUE;
+}
+
+/*
+ * refin == FALSE : table[0] is the MSB-first table of poly ( param->poly aligned to the top bit ).
+ * refin == TRUE  : table[0] is the LSB-first table of the reflected poly, so the
+ *                  input bytes are used as they are ( the register is reflected ).
+ */
+static unsigned int HEXIN_CORE_FN( _compute_init_table )( struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE poly, struct HEXIN_CORE_TABLES *tables )
+{
+    unsigned int i = 0, j = 0;
+    HEXIN_CORE_TYPE crc = 0;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        HEXIN_CORE_FN( _init_table_poly_is_high )( HEXIN_CORE_FN( _reverse )( poly ), tables->table[0] );
+    } else {
+        HEXIN_CORE_FN( _init_table_poly_is_low  )( poly, tables->table[0] );
+    }
+
+    /* table[j][i] = CRC of byte i followed by j zero bytes ( slicing-by-8 ) */
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = tables->table[0][i];
+        for ( j=1; j<HEXIN_CORE_SLICING; j++ ) {
+            if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+                HEXIN_CORE_BYTE_HIGH( crc, 0, tables->table );
+            } else {
+                HEXIN_CORE_BYTE_LOW( crc, 0, tables->table );
+            }
+            tables->table[j][i] = crc;
+        }
+    }
+
+    /* The register is folded as the top bits of a 64-bit one. */
+    hexin_clmul_init( &tables->clmul, ( ( unsigned long long )poly << HEXIN_CORE_CLMUL_SHIFT ), HEXIN_REFIN_IS_TRUE( param ) );
+
+    /* Probe the CPU ( and build the CRC32C shift tables ) here, hexin_xxx_compute may run without the GIL. */
+    hexin_clmul_is_supported();
+#if defined( HEXIN_CORE_CRC32C )
+    hexin_crc32c_hw_is_supported();
+#endif
+
+    return TRUE;
+}
+
+static HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_slicing_poly_is_low )( HEXIN_CORE_TYPE crc, const unsigned char *pSrc, size_t len,
+                                                                      const HEXIN_CORE_TYPE (*t)[MAX_TABLE_ARRAY] )
+{
+    if ( ( len >= HEXIN_CORE_SLICING ) && ( hexin_cpu_features() & HEXIN_CPU_SLICING ) ) {
+        while ( len >= HEXIN_CORE_SLICING ) {
+            HEXIN_CORE_SLICE_LOW( crc, pSrc, t );
+            len -= HEXIN_CORE_SLICING;
+        }
+    }
+
+    while ( len-- ) {
+        HEXIN_CORE_BYTE_LOW( crc, *pSrc++, t );
+    }
+    return crc;
+}
+
+static HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_slicing_poly_is_high )( HEXIN_CORE_TYPE crc, const unsigned char *pSrc, size_t len,
+                                                                       const HEXIN_CORE_TYPE (*t)[MAX_TABLE_ARRAY] )
+{
+    if ( ( len >= HEXIN_CORE_SLICING ) && ( hexin_cpu_features() & HEXIN_CPU_SLICING ) ) {
+        while ( len >= HEXIN_CORE_SLICING ) {
+            HEXIN_CORE_SLICE_HIGH( crc, pSrc, t );
+            len -= HEXIN_CORE_SLICING;
+        }
+    }
+
+    while ( len-- ) {
+        HEXIN_CORE_BYTE_HIGH( crc, *pSrc++, t );
+    }
+    return crc;
+}
+
+unsigned int HEXIN_CORE_FN( _compute_init )( struct HEXIN_CORE_PARAM *param, struct HEXIN_CORE_TABLES *tables )
+{
+    if ( param->is_initial == FALSE ) {
+        param->is_initial = HEXIN_CORE_FN( _compute_init_table )( param, ( HEXIN_CORE_TYPE )( param->poly << HEXIN_CORE_SHIFT( param ) ), tables );
+    }
+    param->table      = ( const HEXIN_CORE_TYPE (*)[MAX_TABLE_ARRAY] )tables->table;
+    param->clmul      = &tables->clmul;
+    return param->is_initial;
+}
+
+/*
+ * compute() = final( update( start( init ) ) ), the register between them is the raw one
+ * ( reflected when refin, else aligned to the top bit ), the incremental hash objects keep it across update() calls.
+ */
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_start )( const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init, unsigned int is_gradual )
+{
+    HEXIN_CORE_TYPE crc = 0;
+
+    init = ( HEXIN_CORE_TYPE )( init & HEXIN_CORE_MASK( param ) );
+    crc  = ( HEXIN_CORE_TYPE )( init << HEXIN_CORE_SHIFT( param ) );          /* Fixed Issues #4  */
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        /* Fixed Issues #4 #8 : The reflected register of the gradual result is init itself. */
+        if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) ) {
+            crc = init;
+        } else {
+            crc = HEXIN_CORE_FN( _reverse )( crc );
+        }
+    } else {
+        /* Fixed Issues #4 #8 */
+        if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) ) {
+            crc = HEXIN_CORE_FN( _reverse )( init );
+        }
+    }
+    return crc;
+}
+
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_update )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE crc )
+{
+    size_t i = 0;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+#if defined( HEXIN_CORE_CRC32C )
+        /* The crc32 instruction, but the AVX-512 folding is faster on the long buffers. */
+        if ( HEXIN_CRC32C_IS_TRUE( param ) && hexin_crc32c_hw_is_supported() &&
+             ( ( len < HEXIN_CLMUL_AVX512_LENGTH ) || ( hexin_clmul_kernel() != HEXIN_KERNEL_AVX512 ) ) ) {
+            return hexin_crc32c_hw_compute( pSrc, len, crc );
+        }
+#endif
+        if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+            i = ( len & ~( size_t )0x0F );
+            crc = ( HEXIN_CORE_TYPE )hexin_clmul_compute( pSrc, i, ( unsigned long long )crc, param->clmul );
+            pSrc += i;
+            len  -= i;
+        }
+        return HEXIN_CORE_FN( _compute_slicing_poly_is_high )( crc, pSrc, len, param->table );
+    }
+
+    /* The register is the upper bits of a 64-bit one with poly * x^( 64 - BITS ). */
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        i = ( len & ~( size_t )0x0F );
+        crc = ( HEXIN_CORE_TYPE )( hexin_clmul_compute( pSrc, i, ( ( unsigned long long )crc << HEXIN_CORE_CLMUL_SHIFT ), param->clmul ) >> HEXIN_CORE_CLMUL_SHIFT );
+        pSrc += i;
+        len  -= i;
+    }
+    return HEXIN_CORE_FN( _compute_slicing_poly_is_low )( crc, pSrc, len, param->table );
+}
+
+/* The kernel of hexin_xxx_compute_update() for the long buffers of the model ( libscrc.kernel_for ). */
+unsigned int HEXIN_CORE_FN( _compute_kernel )( const struct HEXIN_CORE_PARAM *param )
+{
+#if defined( HEXIN_CORE_CRC32C )
+    if ( HEXIN_REFIN_IS_TRUE( param ) && HEXIN_CRC32C_IS_TRUE( param ) && hexin_crc32c_hw_is_supported() &&
+         ( hexin_clmul_kernel() != HEXIN_KERNEL_AVX512 ) ) {
+        return HEXIN_KERNEL_SSE42;
+    }
+#endif
+    if ( hexin_clmul_is_supported() ) {
+        return hexin_clmul_kernel();
+    }
+    return ( hexin_cpu_features() & HEXIN_CPU_SLICING ) ? HEXIN_KERNEL_SLICING : HEXIN_KERNEL_SCALAR;
+}
+
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_final )( const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE crc )
+{
+    /* Fixed Issues #8 */
+    if ( HEXIN_REFIN_IS_TRUE( param ) != HEXIN_REFOUT_IS_TRUE( param ) ) {
+        crc = HEXIN_CORE_FN( _reverse )( crc );
+    }
+
+    /* A reflected result is in the low width bits already, the other one is aligned to the top bit. */
+    if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
+        return ( HEXIN_CORE_TYPE )( crc ^ param->xorout );
+    }
+    return ( HEXIN_CORE_TYPE )( ( crc >> HEXIN_CORE_SHIFT( param ) ) ^ param->xorout );
+}
+
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init, unsigned int is_gradual )
+{
+    HEXIN_CORE_TYPE crc = HEXIN_CORE_FN( _compute_start )( param, init, is_gradual );
+
+    crc = HEXIN_CORE_FN( _compute_update )( pSrc, len, param, crc );
+    return HEXIN_CORE_FN( _compute_final )( param, crc );
+}
+
+static HEXIN_CORE_TYPE HEXIN_CORE_FN( _gf2_times )( const HEXIN_CORE_TYPE *matrix, HEXIN_CORE_TYPE vector )
+{
+    HEXIN_CORE_TYPE sum = 0;
+
+    while ( vector != 0 ) {
+        if ( vector & 1 ) {
+            sum ^= *matrix;
+        }
+        vector >>= 1;
+        matrix++;
+    }
+    return sum;
+}
+
+/*
+ * power[0] is the operator of one zero byte on the CRC value ( after final() ), power[k] of 2^k zero bytes.
+ * Register bit j is the one final() maps on CRC bit i, so init, xorout and reflection come from the descriptor.
+ */
+void HEXIN_CORE_FN( _combine_init )( const struct HEXIN_CORE_PARAM *param, struct HEXIN_CORE_COMBINE *combine )
+{
+    unsigned int i = 0, j = 0, k = 0;
+    unsigned char zero = 0x00;
+    HEXIN_CORE_TYPE offset = HEXIN_CORE_FN( _compute_final )( param, 0 );
+    HEXIN_CORE_TYPE reg = 0;
+
+    combine->empty = HEXIN_CORE_FN( _compute_final )( param, HEXIN_CORE_FN( _compute_start )( param, param->init, FALSE ) );
+    for ( i=0; i<HEXIN_CORE_BITS; i++ ) {
+        combine->power[0][i] = 0;
+        for ( j=0; j<HEXIN_CORE_BITS; j++ ) {
+            reg = ( HEXIN_CORE_TYPE )( ( HEXIN_CORE_TYPE )1 << j );
+            if ( ( HEXIN_CORE_TYPE )( HEXIN_CORE_FN( _compute_final )( param, reg ) ^ offset ) == ( HEXIN_CORE_TYPE )( ( HEXIN_CORE_TYPE )1 << i ) ) {
+                reg = HEXIN_CORE_FN( _compute_update )( &zero, 1, param, reg );
+                combine->power[0][i] = ( HEXIN_CORE_TYPE )( HEXIN_CORE_FN( _compute_final )( param, reg ) ^ offset );
+                break;
+            }
+        }
+    }
+
+    for ( k=1; k<HEXIN_CORE_COMBINE_POWERS; k++ ) {
+        for ( i=0; i<HEXIN_CORE_BITS; i++ ) {
+            combine->power[k][i] = HEXIN_CORE_FN( _gf2_times )( combine->power[k-1], combine->power[k-1][i] );
+        }
+    }
+}
+
+/* CRC of A + B from crc1 = CRC( A ), crc2 = CRC( B ) and len2 = len( B ), O( log( len2 ) ) */
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _combine )( const struct HEXIN_CORE_COMBINE *combine, HEXIN_CORE_TYPE crc1, HEXIN_CORE_TYPE crc2, unsigned long long len2 )
+{
+    unsigned int k = 0;
+    HEXIN_CORE_TYPE crc = ( HEXIN_CORE_TYPE )( crc1 ^ combine->empty );
+
+    for ( k=0; ( len2 != 0 ) && ( k<HEXIN_CORE_COMBINE_POWERS ); k++, len2 >>= 1 ) {
+        if ( len2 & 1 ) {
+            crc = HEXIN_CORE_FN( _gf2_times )( combine->power[k], crc );
+        }
+    }
+    return ( HEXIN_CORE_TYPE )( crc ^ crc2 );
+}
+
+struct HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, _parallel ) {
+    const struct HEXIN_CORE_PARAM *param;
+    struct HEXIN_CORE_COMBINE *combine;
+    const unsigned char *pSrc;
+    size_t len;
+    size_t size;                  /* Bytes of a part, the last one takes the rest */
+    unsigned int parts;
+    HEXIN_CORE_TYPE init;
+    unsigned int is_gradual;
+    HEXIN_CORE_TYPE crc[HEXIN_POOL_MAX_THREADS];
+};
+
+static void HEXIN_CORE_FN( _parallel_job )( void *arg, unsigned int index )
+{
+    struct HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, _parallel ) *parallel = arg;
+    size_t start = ( size_t )index * parallel->size;
+
+    if ( index == parallel->parts ) {
+        HEXIN_CORE_FN( _combine_init )( parallel->param, parallel->combine );
+    } else if ( index == 0 ) {
+        parallel->crc[0] = HEXIN_CORE_FN( _compute )( parallel->pSrc, parallel->size, parallel->param, parallel->init, parallel->is_gradual );
+    } else {
+        /* Plain CRC of the part, combine() appends it to the CRC of the parts before. */
+        parallel->crc[index] = HEXIN_CORE_FN( _compute )( parallel->pSrc + start,
+                                                          ( index == parallel->parts - 1 ) ? ( parallel->len - start ) : parallel->size,
+                                                          parallel->param, parallel->param->init, FALSE );
+    }
+}
+
+/* Same as hexin_xxx_compute() on at most threads threads, parts of at least chunk bytes. Called without the GIL. */
+HEXIN_CORE_TYPE HEXIN_CORE_FN( _compute_parallel )( const unsigned char *pSrc, size_t len, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE init,
+                                                    unsigned int is_gradual, unsigned int threads, unsigned int chunk )
+{
+    unsigned int i = 0;
+    size_t parts = 0;
+    HEXIN_CORE_TYPE crc = 0;
+    struct HEXIN_CORE_XPASTE( _hexin_, HEXIN_CORE_NAME, _parallel ) parallel;
+
+    parts = ( chunk > 0 ) ? ( len / chunk ) : len;
+    parallel.parts = ( parts > threads ) ? threads : ( unsigned int )parts;
+    parallel.parts = ( parallel.parts > HEXIN_POOL_MAX_THREADS ) ? HEXIN_POOL_MAX_THREADS : parallel.parts;
+    if ( parallel.parts < 2 ) {
+        return HEXIN_CORE_FN( _compute )( pSrc, len, param, init, is_gradual );
+    }
+
+    parallel.combine = ( struct HEXIN_CORE_COMBINE * )malloc( sizeof( struct HEXIN_CORE_COMBINE ) );
+    if ( parallel.combine == NULL ) {
+        return HEXIN_CORE_FN( _compute )( pSrc, len, param, init, is_gradual );
+    }
+    parallel.param      = param;
+    parallel.pSrc       = pSrc;
+    parallel.len        = len;
+    parallel.size       = len / parallel.parts;
+    parallel.init       = init;
+    parallel.is_gradual = is_gradual;
+
+    /* The last job builds the combine operators while the others hash. */
+    hexin_pool_run( HEXIN_CORE_FN( _parallel_job ), &parallel, parallel.parts + 1, parallel.parts );
+
+    crc = parallel.crc[0];
+    for ( i=1; i<parallel.parts; i++ ) {
+        crc = HEXIN_CORE_FN( _combine )( parallel.combine, crc, parallel.crc[i],
+                                         ( i == parallel.parts - 1 ) ? ( len - i * parallel.size ) : parallel.size );
+    }
+    free( parallel.combine );
+    return crc;
+}
+
+/* Slicing-by-8 step of four independent registers, the lookups of the lanes overlap. */
+static void HEXIN_CORE_FN( _compute_lockstep )( const unsigned char **p, size_t blocks, const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE *crc )
+{
+    size_t i = 0;
+    const HEXIN_CORE_TYPE (*t)[MAX_TABLE_ARRAY] = param->table;
+    const unsigned char *p0 = p[0], *p1 = p[1], *p2 = p[2], *p3 = p[3];
+    HEXIN_CORE_TYPE c0 = crc[0], c1 = crc[1], c2 = crc[2], c3 = crc[3];
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        for ( i=0; i<blocks; i++ ) {
+            HEXIN_CORE_SLICE_HIGH( c0, p0, t );
+            HEXIN_CORE_SLICE_HIGH( c1, p1, t );
+            HEXIN_CORE_SLICE_HIGH( c2, p2, t );
+            HEXIN_CORE_SLICE_HIGH( c3, p3, t );
+        }
+    } else {
+        for ( i=0; i<blocks; i++ ) {
+            HEXIN_CORE_SLICE_LOW( c0, p0, t );
+            HEXIN_CORE_SLICE_LOW( c1, p1, t );
+            HEXIN_CORE_SLICE_LOW( c2, p2, t );
+            HEXIN_CORE_SLICE_LOW( c3, p3, t );
+        }
+    }
+
+    crc[0] = c0;    crc[1] = c1;    crc[2] = c2;    crc[3] = c3;
+    p[0]   = p0;    p[1]   = p1;    p[2]   = p2;    p[3]   = p3;
+}
+
+/*
+ * result[i] = hexin_xxx_compute( pSrc[i], len[i], param, param->init, FALSE ) for i < count.
+ * Multi-buffer: each HEXIN_CORE_LANES frames advance in lockstep over the blocks of the shortest one,
+ * the rest of the longer ones is hashed on its own. Frames long enough for the SSE4.2 / PCLMULQDQ paths
+ * ( see hexin_xxx_compute_update ) skip the lockstep.
+ */
+void HEXIN_CORE_FN( _compute_multi )( const unsigned char * const *pSrc, const size_t *len, size_t count,
+                                      const struct HEXIN_CORE_PARAM *param, HEXIN_CORE_TYPE *result )
+{
+    unsigned int k = 0;
+    size_t i = 0, step = 0;
+    const unsigned char *p[HEXIN_CORE_LANES] = { NULL };
+    HEXIN_CORE_TYPE crc[HEXIN_CORE_LANES] = { 0 };
+    HEXIN_CORE_TYPE start = HEXIN_CORE_FN( _compute_start )( param, param->init, FALSE );
+    size_t hardware = hexin_clmul_is_supported() ? HEXIN_CLMUL_MIN_LENGTH : ( size_t )-1;
+
+    if ( ( hexin_cpu_features() & HEXIN_CPU_SLICING ) == 0 ) {
+        hardware = 0;                                                   /* The scalar kernel, no lockstep */
+    }
+
+#if defined( HEXIN_CORE_CRC32C )
+    if ( HEXIN_CRC32C_IS_TRUE( param ) && hexin_crc32c_hw_is_supported() ) {
+        hardware = 0;
+    }
+#endif
+
+    for ( i=0; i + HEXIN_CORE_LANES <= count; i += HEXIN_CORE_LANES ) {
+        step = len[i];
+        for ( k=0; k<HEXIN_CORE_LANES; k++ ) {
+            p[k]   = pSrc[i + k];
+            crc[k] = start;
+            step   = ( len[i + k] < step ) ? len[i + k] : step;
+        }
+        if ( step < hardware ) {
+            HEXIN_CORE_FN( _compute_lockstep )( p, step / HEXIN_CORE_SLICING, param, crc );
+        }
+        for ( k=0; k<HEXIN_CORE_LANES; k++ ) {
+            crc[k] = HEXIN_CORE_FN( _compute_update )( p[k], len[i + k] - ( size_t )( p[k] - pSrc[i + k] ), param, crc[k] );
+            result[i + k] = HEXIN_CORE_FN( _compute_final )( param, crc[k] );
+        }
+    }
+
+    for ( ; i<count; i++ ) {
+        result[i] = HEXIN_CORE_FN( _compute_final )( param, HEXIN_CORE_FN( _compute_update )( pSrc[i], len[i], param, start ) );
+    }
+}
+
+#undef HEXIN_CORE_SHIFT
+#undef HEXIN_CORE_MASK
+#undef HEXIN_CORE_TOP
+#undef HEXIN_CORE_CLMUL_SHIFT
+#undef HEXIN_CORE_SLICE_HIGH
+#undef HEXIN_CORE_SLICE_LOW
+#undef HEXIN_CORE_BYTE_HIGH
+#undef HEXIN_CORE_BYTE_LOW
@@ -0,0 +1,156 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_cpu.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-16 [Heyn] Initialize.
+*                       2022-06-06 [Heyn] New add AVX2 ( cpuid leaf 7 and the OS XSAVE state ).
+*                       2022-06-13 [Heyn] New add AVX-512 / VPCLMULQDQ, the features are capped by LIBSCRC_KERNEL=<kernel>.
+*
+*********************************************************************************************************
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "_hexin_cpu.h"
+
+#if defined( HEXIN_X86_64 )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif /* HEXIN_X86_64 */
+
+#if defined( HEXIN_X86_64 )
+static void __hexin_cpuid( unsigned int leaf, unsigned int subleaf, unsigned int regs[4] )
+{
+#if defined( _MSC_VER )
+    int info[4] = { 0 };
+    __cpuidex( info, ( int )leaf, ( int )subleaf );
+    regs[0] = ( unsigned int )info[0];
+    regs[1] = ( unsigned int )info[1];
+    regs[2] = ( unsigned int )info[2];
+    regs[3] = ( unsigned int )info[3];
+#else
+    __cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+/* XCR0, the register states the OS saves, only valid with OSXSAVE set. */
+static unsigned long long __hexin_xgetbv( void )
+{
+#if defined( _MSC_VER )
+    return ( unsigned long long )_xgetbv( 0 );
+#else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+    return ( ( unsigned long long )edx << 32 ) | eax;
+#endif
+}
+#endif /* HEXIN_X86_64 */
+
+static unsigned int __hexin_cpu_detect( void )
+{
+    unsigned int features = 0;
+#if defined( HEXIN_X86_64 )
+    unsigned int regs[4] = { 0 };
+    unsigned int leaves  = 0;
+    unsigned int is_ymm  = 0;
+    unsigned int is_zmm  = 0;
+    unsigned long long xcr0 = 0;
+
+    __hexin_cpuid( 0, 0, regs );
+    leaves = regs[0];
+    if ( leaves < 1 ) {
+        return 0;
+    }
+
+    __hexin_cpuid( 1, 0, regs );
+    if ( regs[2] & ( 1 <<  9 ) ) features |= HEXIN_CPU_SSSE3;
+    if ( regs[2] & ( 1 << 19 ) ) features |= HEXIN_CPU_SSE41;
+    if ( regs[2] & ( 1 <<  1 ) ) features |= HEXIN_CPU_PCLMUL;
+    if ( regs[2] & ( 1 << 20 ) ) features |= HEXIN_CPU_SSE42;
+
+    /* AVX and OSXSAVE, and the OS saves the XMM and YMM registers */
+    if ( ( ( regs[2] & ( 1 << 28 ) ) != 0 ) && ( ( regs[2] & ( 1 << 27 ) ) != 0 ) ) {
+        xcr0   = __hexin_xgetbv();
+        is_ymm = ( ( xcr0 & 0x06 ) == 0x06 );
+        is_zmm = ( ( xcr0 & 0xE6 ) == 0xE6 );                          /* And the opmask, ZMM0-15 upper and ZMM16-31 */
+    }
+
+    if ( is_ymm && ( leaves >= 7 ) ) {
+        __hexin_cpuid( 7, 0, regs );
+        if ( regs[1] & ( 1 <<  5 ) ) features |= HEXIN_CPU_AVX2;
+        if ( regs[2] & ( 1 << 10 ) ) features |= HEXIN_CPU_VPCLMUL;
+        /* AVX512F, AVX512BW and AVX512VL */
+        if ( is_zmm && ( ( regs[1] & 0xC0010000 ) == 0xC0010000 ) ) {
+            features |= HEXIN_CPU_AVX512;
+        }
+    }
+#endif /* HEXIN_X86_64 */
+    return features;
+}
+
+const struct _hexin_cpu_name hexin_cpu_names[] = {
+    { HEXIN_CPU_SSSE3,   "ssse3"      },
+    { HEXIN_CPU_SSE41,   "sse4.1"     },
+    { HEXIN_CPU_SSE42,   "sse4.2"     },
+    { HEXIN_CPU_PCLMUL,  "pclmul"     },
+    { HEXIN_CPU_AVX2,    "avx2"       },
+    { HEXIN_CPU_AVX512,  "avx512"     },
+    { HEXIN_CPU_VPCLMUL, "vpclmul"    },
+    { 0,                 NULL         },
+};
+
+/* The features each kernel may use, index HEXIN_KERNEL_XXX */
+static const struct _hexin_cpu_name hexin_cpu_kernels[HEXIN_KERNEL_COUNT] = {
+    { 0,                                                                                            "scalar"  },
+    { HEXIN_CPU_SLICING,                                                                            "slicing" },
+    { HEXIN_CPU_SLICING | HEXIN_CPU_SSSE3 | HEXIN_CPU_SSE41 | HEXIN_CPU_SSE42,                      "sse4.2"  },
+    { HEXIN_CPU_SLICING | HEXIN_CPU_SSSE3 | HEXIN_CPU_SSE41 | HEXIN_CPU_SSE42 | HEXIN_CPU_PCLMUL,   "pclmul"  },
+    { HEXIN_CPU_SLICING | HEXIN_CPU_SSSE3 | HEXIN_CPU_SSE41 | HEXIN_CPU_SSE42 | HEXIN_CPU_PCLMUL |
+      HEXIN_CPU_AVX2,                                                                               "avx2"    },
+    { ( unsigned int )~0,                                                                           "avx512"  },
+};
+
+const char *hexin_cpu_kernel_name( unsigned int kernel )
+{
+    return ( kernel < HEXIN_KERNEL_COUNT ) ? hexin_cpu_kernels[kernel].name : NULL;
+}
+
+/* LIBSCRC_KERNEL=<name> keeps the features of that kernel and the ones below, an unknown name keeps all. */
+static unsigned int __hexin_cpu_allowed( void )
+{
+    unsigned int i = 0;
+    const char *name = getenv( HEXIN_KERNEL_ENVIRONMENT );
+
+    if ( ( name != NULL ) && ( *name != '\0' ) ) {
+        for ( i=0; i<HEXIN_KERNEL_COUNT; i++ ) {
+            if ( strcmp( name, hexin_cpu_kernels[i].name ) == 0 ) {
+                return hexin_cpu_kernels[i].value;
+            }
+        }
+    }
+    return ( unsigned int )~0;
+}
+
+/*
+ * Detected once ( the modules call it at import ), later calls only read the cached value.
+ */
+unsigned int hexin_cpu_features( void )
+{
+    static unsigned int is_initial = 0;
+    static unsigned int features   = 0;
+
+    if ( is_initial == 0 ) {
+        features   = ( __hexin_cpu_detect() | HEXIN_CPU_SLICING ) & __hexin_cpu_allowed();
+        is_initial = 1;
+    }
+    return features;
+}
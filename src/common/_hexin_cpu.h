@@ -0,0 +1,67 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_cpu.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-16 [Heyn] Initialize.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-06 [Heyn] New add HEXIN_CPU_AVX2.
+*                       2022-06-13 [Heyn] New add HEXIN_CPU_AVX512/VPCLMUL, the kernels ( HEXIN_KERNEL_XXX ) and LIBSCRC_KERNEL.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_CPU_H__
+#define __HEXIN_CPU_H__
+
+#include <stddef.h>
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#define                 HEXIN_X86_64                            1
+#endif
+
+#if defined( HEXIN_X86_64 ) && !defined( _MSC_VER )
+#define                 HEXIN_TARGET(x)                         __attribute__(( target( x ) ))
+#else
+#define                 HEXIN_TARGET(x)
+#endif
+
+#define                 HEXIN_CPU_SSSE3                         ( 1 << 0 )
+#define                 HEXIN_CPU_SSE41                         ( 1 << 1 )
+#define                 HEXIN_CPU_PCLMUL                        ( 1 << 2 )
+#define                 HEXIN_CPU_SSE42                         ( 1 << 3 )
+#define                 HEXIN_CPU_AVX2                          ( 1 << 4 )      /* And enabled by the OS ( XSAVE of the YMM state ) */
+#define                 HEXIN_CPU_AVX512                        ( 1 << 5 )      /* AVX512F/BW/VL, and enabled by the OS ( ZMM state ) */
+#define                 HEXIN_CPU_VPCLMUL                       ( 1 << 6 )      /* VPCLMULQDQ on YMM / ZMM registers */
+#define                 HEXIN_CPU_SLICING                       ( 1 << 7 )      /* Not a CPU feature, slicing-by-8 tables ( off for the scalar kernel ) */
+
+/*
+ * The kernels, from the plain byte table up. LIBSCRC_KERNEL=<name> in the environment caps the
+ * dispatch at one of them ( the features of the higher ones are masked ), read once at import.
+ */
+#define                 HEXIN_KERNEL_SCALAR                     0               /* Byte table */
+#define                 HEXIN_KERNEL_SLICING                    1               /* Slicing-by-8 tables */
+#define                 HEXIN_KERNEL_SSE42                      2               /* SSSE3 / SSE4.1 / SSE4.2 ( crc32 instruction ) */
+#define                 HEXIN_KERNEL_PCLMUL                     3               /* PCLMULQDQ folding */
+#define                 HEXIN_KERNEL_AVX2                       4
+#define                 HEXIN_KERNEL_AVX512                     5
+#define                 HEXIN_KERNEL_COUNT                      6
+
+#define                 HEXIN_KERNEL_ENVIRONMENT                "LIBSCRC_KERNEL"
+
+struct _hexin_cpu_name {
+    unsigned int        value;
+    const char          *name;
+};
+
+extern const struct _hexin_cpu_name hexin_cpu_names[];             /* { HEXIN_CPU_XXX, "name" }, ends with { 0, NULL } */
+
+unsigned int hexin_cpu_features( void );
+const char *hexin_cpu_kernel_name( unsigned int kernel );
+
+#endif //__HEXIN_CPU_H__
@@ -0,0 +1,159 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_crc32c.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-18 [Heyn] Initialize.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "_hexin_crc32c.h"
+
+#if defined( HEXIN_X86_64 )
+#include <immintrin.h>
+#endif /* HEXIN_X86_64 */
+
+#if defined( HEXIN_X86_64 )
+
+/*
+ * Three streams are run in parallel to hide the latency of the crc32 instruction,
+ * then merged by shifting the earlier ones over LONG ( or SHORT ) zero bytes.
+ */
+static unsigned int hexin_crc32c_long[4][256];
+static unsigned int hexin_crc32c_short[4][256];
+static unsigned int hexin_crc32c_is_initial = 0;
+
+/* a * b mod P, reflected. */
+static unsigned int __hexin_crc32c_multmodp( unsigned int a, unsigned int b )
+{
+    unsigned int m = 0x80000000L, p = 0;
+
+    for ( ;; ) {
+        if ( a & m ) {
+            p ^= b;
+            if ( ( a & ( m - 1 ) ) == 0 ) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = ( b & 1 ) ? ( ( b >> 1 ) ^ HEXIN_CRC32C_POLYNOMIAL_REFLECTED ) : ( b >> 1 );
+    }
+    return p;
+}
+
+static void __hexin_crc32c_init_shift_table( unsigned int table[4][256], unsigned int len )
+{
+    unsigned int i = 0, k = 0;
+    unsigned int xn = 0x80000000L;     /* x^0 */
+
+    for ( i=0; i<len*8; i++ ) {
+        xn = ( xn & 1 ) ? ( ( xn >> 1 ) ^ HEXIN_CRC32C_POLYNOMIAL_REFLECTED ) : ( xn >> 1 );
+    }
+
+    for ( k=0; k<4; k++ ) {
+        for ( i=0; i<256; i++ ) {
+            table[k][i] = __hexin_crc32c_multmodp( xn, i << ( k * 8 ) );
+        }
+    }
+}
+
+static unsigned int __hexin_crc32c_shift( unsigned int table[4][256], unsigned int crc )
+{
+    return table[0][ ( crc >>  0 ) & 0xFF ] ^ table[1][ ( crc >>  8 ) & 0xFF ] ^
+           table[2][ ( crc >> 16 ) & 0xFF ] ^ table[3][ ( crc >> 24 ) & 0xFF ];
+}
+
+static unsigned long long __hexin_load64( const unsigned char *p )
+{
+    unsigned long long v = 0;
+    memcpy( &v, p, sizeof( v ) );
+    return v;
+}
+
+/*
+ * The shift tables are built here, so call it ( with the GIL held ) before hexin_crc32c_hw_compute.
+ */
+unsigned int hexin_crc32c_hw_is_supported( void )
+{
+    if ( ( hexin_cpu_features() & HEXIN_CPU_SSE42 ) == 0 ) {
+        return 0;
+    }
+
+    if ( hexin_crc32c_is_initial == 0 ) {
+        __hexin_crc32c_init_shift_table( hexin_crc32c_long,  HEXIN_CRC32C_LONG  );
+        __hexin_crc32c_init_shift_table( hexin_crc32c_short, HEXIN_CRC32C_SHORT );
+        hexin_crc32c_is_initial = 1;
+    }
+    return 1;
+}
+
+#define __HEXIN_CRC32C_TARGET   HEXIN_TARGET( "sse4.2" )
+
+#define __HEXIN_CRC32C_INTERLEAVE( SIZE, TABLE )                                                        \
+    while ( len >= ( SIZE ) * 3 ) {                                                                     \
+        unsigned long long crc1 = 0, crc2 = 0;                                                          \
+        const unsigned char *end = pSrc + ( SIZE );                                                     \
+        do {                                                                                            \
+            crc0 = _mm_crc32_u64( crc0, __hexin_load64( pSrc ) );                                       \
+            crc1 = _mm_crc32_u64( crc1, __hexin_load64( pSrc + ( SIZE ) ) );                            \
+            crc2 = _mm_crc32_u64( crc2, __hexin_load64( pSrc + ( SIZE ) * 2 ) );                        \
+            pSrc += 8;                                                                                  \
+        } while ( pSrc < end );                                                                         \
+        crc0  = __hexin_crc32c_shift( TABLE, ( unsigned int )crc0 ) ^ crc1;                             \
+        crc0  = __hexin_crc32c_shift( TABLE, ( unsigned int )crc0 ) ^ crc2;                             \
+        pSrc += ( SIZE ) * 2;                                                                           \
+        len  -= ( SIZE ) * 3;                                                                           \
+    }
+
+__HEXIN_CRC32C_TARGET
+unsigned int hexin_crc32c_hw_compute( const unsigned char *pSrc, size_t len, unsigned int crc32 )
+{
+    unsigned long long crc0 = crc32;
+
+    while ( ( len > 0 ) && ( ( ( size_t )pSrc & 7 ) != 0 ) ) {
+        crc0 = _mm_crc32_u8( ( unsigned int )crc0, *pSrc++ );
+        len--;
+    }
+
+    __HEXIN_CRC32C_INTERLEAVE( HEXIN_CRC32C_LONG,  hexin_crc32c_long  )
+    __HEXIN_CRC32C_INTERLEAVE( HEXIN_CRC32C_SHORT, hexin_crc32c_short )
+
+    while ( len >= 8 ) {
+        crc0 = _mm_crc32_u64( crc0, __hexin_load64( pSrc ) );
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc0 = _mm_crc32_u8( ( unsigned int )crc0, *pSrc++ );
+    }
+
+    return ( unsigned int )crc0;
+}
+
+#undef __HEXIN_CRC32C_INTERLEAVE
+
+#else
+
+unsigned int hexin_crc32c_hw_is_supported( void )
+{
+    return 0;
+}
+
+unsigned int hexin_crc32c_hw_compute( const unsigned char *pSrc, size_t len, unsigned int crc32 )
+{
+    /* Never selected, hexin_crc32c_hw_is_supported() is always FALSE here. */
+    ( void )pSrc;
+    ( void )len;
+    return crc32;
+}
+
+#endif /* HEXIN_X86_64 */
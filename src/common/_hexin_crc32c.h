@@ -0,0 +1,35 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_crc32c.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-05-18 [Heyn] Initialize.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_CRC32C_H__
+#define __HEXIN_CRC32C_H__
+
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_CRC32C_POLYNOMIAL                 0x1EDC6F41L
+#define                 HEXIN_CRC32C_POLYNOMIAL_REFLECTED       0x82F63B78L
+
+#define                 HEXIN_CRC32C_LONG                       8192
+#define                 HEXIN_CRC32C_SHORT                      256
+
+unsigned int hexin_crc32c_hw_is_supported( void );
+
+/*
+ * crc32 : reflected register ( no pre/post inversion ), as the SSE4.2 crc32 instruction.
+ */
+unsigned int hexin_crc32c_hw_compute( const unsigned char *pSrc, size_t len, unsigned int crc32 );
+
+#endif //__HEXIN_CRC32C_H__
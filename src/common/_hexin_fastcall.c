@@ -0,0 +1,202 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_fastcall.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-05 [Heyn] Initialize.
+*                       2022-06-15 [Heyn] New add hexin_fastcall_string().
+*                       2022-06-15 [Heyn] New add hexin_fastcall_bounded().
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_hexin_fastcall.h"
+
+static int hexin_fastcall_keyword( PyObject *key, PyObject *value, const char * const *kwlist, Py_ssize_t size, PyObject **values )
+{
+    Py_ssize_t i = 0;
+
+    for ( i=0; i<size; i++ ) {
+#if PY_MAJOR_VERSION >= 3
+        if ( PyUnicode_Check( key ) && ( PyUnicode_CompareWithASCIIString( key, kwlist[i] ) == 0 ) ) {
+#else
+        if ( PyString_Check( key ) && ( strcmp( PyString_AS_STRING( key ), kwlist[i] ) == 0 ) ) {
+#endif /* PY_MAJOR_VERSION */
+            if ( values[i] != NULL ) {
+                PyErr_Format( PyExc_TypeError, "argument for function given by name ('%s') and position (%zd)", kwlist[i], i + 1 );
+                return 0;
+            }
+            values[i] = value;
+            return 1;
+        }
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    PyErr_Format( PyExc_TypeError, "'%S' is an invalid keyword argument for this function", key );
+#else
+    PyErr_SetString( PyExc_TypeError, "invalid keyword argument for this function" );
+#endif /* PY_MAJOR_VERSION */
+    return 0;
+}
+
+Py_ssize_t hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, const char * const *kwlist, Py_ssize_t required, PyObject **values )
+{
+    Py_ssize_t i = 0, size = 0, nkws = 0;
+    PyObject *key = NULL, *value = NULL;
+#if HEXIN_FASTCALL
+    nkws  = ( kwnames != NULL ) ? PyTuple_GET_SIZE( kwnames ) : 0;
+#else
+    Py_ssize_t pos   = 0;
+    Py_ssize_t nargs = PyTuple_GET_SIZE( args );
+    nkws  = ( kwnames != NULL ) ? PyDict_Size( kwnames ) : 0;
+#endif /* HEXIN_FASTCALL */
+
+    for ( size=0; kwlist[size] != NULL; size++ ) {
+        values[size] = NULL;
+    }
+
+    if ( nargs > size ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd arguments (%zd given)", size, nargs + nkws );
+        return -1;
+    }
+
+    for ( i=0; i<nargs; i++ ) {
+#if HEXIN_FASTCALL
+        values[i] = args[i];
+#else
+        values[i] = PyTuple_GET_ITEM( args, i );
+#endif /* HEXIN_FASTCALL */
+    }
+
+#if HEXIN_FASTCALL
+    for ( i=0; i<nkws; i++ ) {
+        key   = PyTuple_GET_ITEM( kwnames, i );
+        value = args[nargs + i];
+        if ( !hexin_fastcall_keyword( key, value, kwlist, size, values ) ) {
+            return -1;
+        }
+    }
+#else
+    while ( ( kwnames != NULL ) && PyDict_Next( kwnames, &pos, &key, &value ) ) {
+        if ( !hexin_fastcall_keyword( key, value, kwlist, size, values ) ) {
+            return -1;
+        }
+    }
+#endif /* HEXIN_FASTCALL */
+
+    for ( i=0; i<required; i++ ) {
+        if ( values[i] == NULL ) {
+            PyErr_Format( PyExc_TypeError, "function missing required argument '%s' (pos %zd)", kwlist[i], i + 1 );
+            return -1;
+        }
+    }
+
+    return nargs + nkws;
+}
+
+int hexin_fastcall_string( PyObject *obj, const char **value )
+{
+    const char *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyUnicode_Check( obj ) ) {
+        PyErr_Format( PyExc_TypeError, "argument must be str, not %.50s", Py_TYPE( obj )->tp_name );
+        return 0;
+    }
+    result = PyUnicode_AsUTF8( obj );
+#else
+    result = PyString_AsString( obj );
+#endif /* PY_MAJOR_VERSION */
+    if ( result == NULL ) {
+        return 0;
+    }
+
+    *value = result;
+    return 1;
+}
+
+int hexin_fastcall_buffer( PyObject *obj, Py_buffer *view )
+{
+#if PY_MAJOR_VERSION >= 3
+    return ( PyObject_GetBuffer( obj, view, PyBUF_SIMPLE ) == 0 );
+#else
+    return PyArg_Parse( obj, "s*", view );
+#endif /* PY_MAJOR_VERSION */
+}
+
+int hexin_fastcall_unsigned( PyObject *obj, unsigned long long *value )
+{
+    unsigned long long result = 0;
+
+    if ( obj == NULL ) {
+        return 1;
+    }
+
+    if ( PyFloat_Check( obj ) ) {
+        PyErr_SetString( PyExc_TypeError, "'float' object cannot be interpreted as an integer" );
+        return 0;
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    result = PyLong_AsUnsignedLongLongMask( obj );
+#else
+    result = PyInt_AsUnsignedLongLongMask( obj );
+#endif /* PY_MAJOR_VERSION */
+    if ( ( result == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        return 0;
+    }
+
+    *value = result;
+    return 1;
+}
+
+int hexin_fastcall_bounded( PyObject *obj, unsigned long long max, unsigned long long *value )
+{
+    PyObject *index = NULL;
+    unsigned long long result = 0;
+
+    if ( obj == NULL ) {
+        return 1;
+    }
+
+    index = PyNumber_Index( obj );
+    if ( index == NULL ) {
+        return 0;
+    }
+    result = PyLong_AsUnsignedLongLong( index );
+    Py_DECREF( index );
+    if ( ( result == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        return 0;
+    }
+
+    if ( result > max ) {
+        PyErr_Format( PyExc_OverflowError, "%llu is greater than maximum %llu", result, max );
+        return 0;
+    }
+
+    *value = result;
+    return 1;
+}
+
+int hexin_fastcall_bool( PyObject *obj, unsigned int *value )
+{
+    int result = 0;
+
+    if ( obj == NULL ) {
+        return 1;
+    }
+
+    result = PyObject_IsTrue( obj );
+    if ( result < 0 ) {
+        return 0;
+    }
+
+    *value = ( unsigned int )result;
+    return 1;
+}
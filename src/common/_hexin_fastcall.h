@@ -0,0 +1,76 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_fastcall.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-05 [Heyn] Initialize.
+*                       Argument parsing of the model functions, METH_FASTCALL from Python 3.7.
+*                       2022-06-15 [Heyn] New add hexin_fastcall_string(), libscrc.new() / combine() / batch() / kernel_for() are METH_FASTCALL too.
+*                       2022-06-15 [Heyn] New add hexin_fastcall_bounded(), threads=N and chunk=N are range checked.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_FASTCALL_H__
+#define __HEXIN_FASTCALL_H__
+
+#include <Python.h>
+
+/*
+ * Python >= 3.7 : METH_FASTCALL, the arguments are a C array ( + a tuple of keyword names ), no tuple or dict is built.
+ * Python <  3.7 : METH_VARARGS, the arguments are a tuple ( + a dict of keywords ).
+ * A function declared ( PyObject *self, HEXIN_FASTCALL_ARGS ) goes in the method table with HEXIN_METH_FASTCALL_KEYWORDS,
+ * one declared ( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS ) with HEXIN_METH_FASTCALL.
+ */
+#if PY_VERSION_HEX >= 0x03070000
+#define                 HEXIN_FASTCALL                          1
+#define                 HEXIN_METH_FASTCALL                     METH_FASTCALL
+#define                 HEXIN_METH_FASTCALL_KEYWORDS            METH_FASTCALL|METH_KEYWORDS
+#define                 HEXIN_FASTCALL_ARGS                     PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames
+#define                 HEXIN_FASTCALL_PASS                     args, nargs, kwnames
+#define                 HEXIN_FASTCALL_NOKW_ARGS                PyObject *const *args, Py_ssize_t nargs
+#define                 HEXIN_FASTCALL_NOKW_PASS                args, nargs
+#else
+#define                 HEXIN_FASTCALL                          0
+#define                 HEXIN_METH_FASTCALL                     METH_VARARGS
+#define                 HEXIN_METH_FASTCALL_KEYWORDS            METH_KEYWORDS|METH_VARARGS
+#define                 HEXIN_FASTCALL_ARGS                     PyObject *args, PyObject *kwnames
+#define                 HEXIN_FASTCALL_PASS                     args, kwnames
+#define                 HEXIN_FASTCALL_NOKW_ARGS                PyObject *args
+#define                 HEXIN_FASTCALL_NOKW_PASS                args
+#endif /* PY_VERSION_HEX */
+
+/* Result of a model function, an int ( not a long on Python 2 ) like Py_BuildValue( "I" ) */
+#if PY_MAJOR_VERSION >= 3
+#define                 hexin_PyLong_FromUnsigned(x)            PyLong_FromUnsignedLong( ( unsigned long )( x ) )
+#else
+#define                 hexin_PyLong_FromUnsigned(x)            PyInt_FromSize_t( ( size_t )( x ) )
+#endif /* PY_MAJOR_VERSION */
+
+/*
+ * values[i] = the argument of kwlist[i] ( borrowed ), NULL when not passed. The first required ones must be passed.
+ * Returns the number of arguments passed, -1 with a TypeError set.
+ */
+Py_ssize_t hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, const char * const *kwlist, Py_ssize_t required, PyObject **values );
+
+/* "s" : a str, value points in obj ( valid while obj is ). */
+int hexin_fastcall_string( PyObject *obj, const char **value );
+
+/* "y*" ( "s*" on Python 2 ), the caller releases the view. */
+int hexin_fastcall_buffer( PyObject *obj, Py_buffer *view );
+
+/* "B" / "H" / "I" / "K" : an integer without overflow checking, value is left alone when obj is NULL. */
+int hexin_fastcall_unsigned( PyObject *obj, unsigned long long *value );
+
+/* A count 0 .. max ( OverflowError outside ), value is left alone when obj is NULL. */
+int hexin_fastcall_bounded( PyObject *obj, unsigned long long max, unsigned long long *value );
+
+/* "p" : the truth of obj, value is left alone when obj is NULL. */
+int hexin_fastcall_bool( PyObject *obj, unsigned int *value );
+
+#endif //__HEXIN_FASTCALL_H__
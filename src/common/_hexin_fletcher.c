@@ -0,0 +1,208 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_fletcher.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-08 [Heyn] Initialize.
+*
+*********************************************************************************************************
+*/
+
+#include "_hexin_fletcher.h"
+
+#if defined( HEXIN_X86_64 )
+#include <immintrin.h>
+#endif /* HEXIN_X86_64 */
+
+#define __HEXIN_FLETCHER16_RUN          1024            /* AVX2 steps between two reductions of the word sums */
+
+static void __hexin_fletcher_sum8_scalar( const unsigned char *pSrc, size_t len, unsigned int modulus, unsigned int sums[2] )
+{
+    unsigned int sum1 = sums[0], sum2 = sums[1];
+    size_t n = 0;
+
+    while ( len ) {
+        n    = ( len > HEXIN_FLETCHER8_NMAX ) ? HEXIN_FLETCHER8_NMAX : len;
+        len -= n;
+        do {
+            sum1 += *pSrc++;
+            sum2 += sum1;
+        } while ( --n );
+        sum1 %= modulus;
+        sum2 %= modulus;
+    }
+
+    sums[0] = sum1 % modulus;
+    sums[1] = sum2 % modulus;
+}
+
+static void __hexin_fletcher_sum16_scalar( const unsigned char *pSrc, size_t len, unsigned int sums[2] )
+{
+    unsigned int sum1 = sums[0], sum2 = sums[1];
+    size_t n = 0;
+
+    while ( len >= 2 ) {
+        n    = len / 2;
+        n    = ( n > HEXIN_FLETCHER16_NMAX ) ? HEXIN_FLETCHER16_NMAX : n;
+        len -= n * 2;
+        do {
+            sum1 += ( unsigned int )pSrc[0] | ( ( unsigned int )pSrc[1] << 8 );
+            sum2 += sum1;
+            pSrc += 2;
+        } while ( --n );
+        sum1 %= 65535;
+        sum2 %= 65535;
+    }
+
+    if ( len ) {
+        sum1 += pSrc[0];
+        sum2 += sum1;
+    }
+
+    sums[0] = sum1 % 65535;
+    sums[1] = sum2 % 65535;
+}
+
+#if defined( HEXIN_X86_64 )
+
+HEXIN_TARGET( "avx2" )
+static unsigned int __hexin_fletcher_hsum256( __m256i v )
+{
+    __m128i x = _mm_add_epi32( _mm256_castsi256_si128( v ), _mm256_extracti128_si256( v, 1 ) );
+
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    return ( unsigned int )_mm_cvtsi128_si32( x );
+}
+
+/*
+ * Per block of 32 bytes : sum2 += 32 * sum1 + 32 * b[0] + ... + 1 * b[31], sum1 += b[0] + ... + b[31].
+ * The 32 * sum1 terms are accumulated in v_ps, as in the Adler-32 kernel.
+ */
+HEXIN_TARGET( "avx2" )
+static void __hexin_fletcher_sum8_avx2( const unsigned char *pSrc, size_t len, unsigned int modulus, unsigned int sums[2] )
+{
+    unsigned int sum1 = sums[0] % modulus, sum2 = sums[1] % modulus;
+    size_t blocks = len / HEXIN_FLETCHER_BLOCK;
+    size_t n = 0;
+
+    const __m256i tap  = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                           16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16( 1 );
+
+    len -= blocks * HEXIN_FLETCHER_BLOCK;
+    while ( blocks ) {
+        __m256i v_ps = zero, v_s1 = zero, v_s2 = zero;
+
+        n = HEXIN_FLETCHER8_NMAX / HEXIN_FLETCHER_BLOCK;
+        if ( n > blocks ) {
+            n = blocks;
+        }
+        blocks -= n;
+        v_ps = _mm256_setr_epi32( ( int )( sum1 * n ), 0, 0, 0, 0, 0, 0, 0 );
+        v_s2 = _mm256_setr_epi32( ( int )sum2, 0, 0, 0, 0, 0, 0, 0 );
+
+        do {
+            const __m256i bytes = _mm256_loadu_si256( ( const __m256i * )pSrc );
+
+            v_ps = _mm256_add_epi32( v_ps, v_s1 );
+            v_s1 = _mm256_add_epi32( v_s1, _mm256_sad_epu8( bytes, zero ) );
+            v_s2 = _mm256_add_epi32( v_s2, _mm256_madd_epi16( _mm256_maddubs_epi16( bytes, tap ), ones ) );
+            pSrc += HEXIN_FLETCHER_BLOCK;
+        } while ( --n );
+
+        v_s2  = _mm256_add_epi32( v_s2, _mm256_slli_epi32( v_ps, 5 ) );
+        sum1 += __hexin_fletcher_hsum256( v_s1 );
+        sum2  = __hexin_fletcher_hsum256( v_s2 );
+        sum1 %= modulus;
+        sum2 %= modulus;
+    }
+
+    _mm256_zeroupper();
+    sums[0] = sum1;
+    sums[1] = sum2;
+    __hexin_fletcher_sum8_scalar( pSrc, len, modulus, sums );
+}
+
+/*
+ * Per block of 16 words w = lo + 256 * hi : sum2 += 16 * sum1 + 16 * w[0] + ... + 1 * w[15], sum1 += w[0] + ... + w[15].
+ * pmaddwd is signed, so the low and the high bytes of the words are summed apart and joined in 64 bits.
+ */
+HEXIN_TARGET( "avx2" )
+static void __hexin_fletcher_sum16_avx2( const unsigned char *pSrc, size_t len, unsigned int sums[2] )
+{
+    unsigned long long sum1 = sums[0] % 65535, sum2 = sums[1] % 65535;
+    size_t blocks = len / HEXIN_FLETCHER_BLOCK;
+    size_t n = 0, steps = 0;
+
+    const __m256i tap_lo = _mm256_setr_epi8( 16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9, 0,
+                                              8, 0,  7, 0,  6, 0,  5, 0,  4, 0,  3, 0,  2, 0, 1, 0 );
+    const __m256i tap_hi = _mm256_setr_epi8( 0, 16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9,
+                                             0,  8, 0,  7, 0,  6, 0,  5, 0,  4, 0,  3, 0,  2, 0, 1 );
+    const __m256i mask   = _mm256_set1_epi16( 0x00FF );
+    const __m256i zero   = _mm256_setzero_si256();
+    const __m256i ones   = _mm256_set1_epi16( 1 );
+
+    len -= blocks * HEXIN_FLETCHER_BLOCK;
+    while ( blocks ) {
+        __m256i v_ps_lo = zero, v_ps_hi = zero, v_s1_lo = zero, v_s1_hi = zero, v_s2_lo = zero, v_s2_hi = zero;
+
+        n = ( blocks > __HEXIN_FLETCHER16_RUN ) ? __HEXIN_FLETCHER16_RUN : blocks;
+        blocks -= n;
+        steps   = n;
+
+        do {
+            const __m256i words = _mm256_loadu_si256( ( const __m256i * )pSrc );
+
+            v_ps_lo = _mm256_add_epi32( v_ps_lo, v_s1_lo );
+            v_ps_hi = _mm256_add_epi32( v_ps_hi, v_s1_hi );
+            v_s1_lo = _mm256_add_epi32( v_s1_lo, _mm256_sad_epu8( _mm256_and_si256( words, mask ), zero ) );
+            v_s1_hi = _mm256_add_epi32( v_s1_hi, _mm256_sad_epu8( _mm256_srli_epi16( words, 8 ), zero ) );
+            v_s2_lo = _mm256_add_epi32( v_s2_lo, _mm256_madd_epi16( _mm256_maddubs_epi16( words, tap_lo ), ones ) );
+            v_s2_hi = _mm256_add_epi32( v_s2_hi, _mm256_madd_epi16( _mm256_maddubs_epi16( words, tap_hi ), ones ) );
+            pSrc += HEXIN_FLETCHER_BLOCK;
+        } while ( --n );
+
+        sum2 += 16 * steps * sum1;
+        sum2 += 16 * ( ( unsigned long long )__hexin_fletcher_hsum256( v_ps_lo ) + 256 * ( unsigned long long )__hexin_fletcher_hsum256( v_ps_hi ) );
+        sum2 += ( unsigned long long )__hexin_fletcher_hsum256( v_s2_lo ) + 256 * ( unsigned long long )__hexin_fletcher_hsum256( v_s2_hi );
+        sum1 += ( unsigned long long )__hexin_fletcher_hsum256( v_s1_lo ) + 256 * ( unsigned long long )__hexin_fletcher_hsum256( v_s1_hi );
+        sum1 %= 65535;
+        sum2 %= 65535;
+    }
+
+    _mm256_zeroupper();
+    sums[0] = ( unsigned int )sum1;
+    sums[1] = ( unsigned int )sum2;
+    __hexin_fletcher_sum16_scalar( pSrc, len, sums );
+}
+
+#endif /* HEXIN_X86_64 */
+
+void hexin_fletcher_sum8( const unsigned char *pSrc, size_t len, unsigned int modulus, unsigned int sums[2] )
+{
+#if defined( HEXIN_X86_64 )
+    if ( ( len >= HEXIN_FLETCHER_BLOCK ) && ( hexin_cpu_features() & HEXIN_CPU_AVX2 ) ) {
+        __hexin_fletcher_sum8_avx2( pSrc, len, modulus, sums );
+        return;
+    }
+#endif /* HEXIN_X86_64 */
+    __hexin_fletcher_sum8_scalar( pSrc, len, modulus, sums );
+}
+
+void hexin_fletcher_sum16( const unsigned char *pSrc, size_t len, unsigned int sums[2] )
+{
+#if defined( HEXIN_X86_64 )
+    if ( ( len >= HEXIN_FLETCHER_BLOCK ) && ( hexin_cpu_features() & HEXIN_CPU_AVX2 ) ) {
+        __hexin_fletcher_sum16_avx2( pSrc, len, sums );
+        return;
+    }
+#endif /* HEXIN_X86_64 */
+    __hexin_fletcher_sum16_scalar( pSrc, len, sums );
+}
@@ -0,0 +1,36 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_fletcher.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-08 [Heyn] Initialize.
+*                       Fletcher sums reduced once per block, AVX2 kernels.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_FLETCHER_H__
+#define __HEXIN_FLETCHER_H__
+
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_FLETCHER8_NMAX                    5552            /* Bytes, sums of a modulus <= 256 fit in 32 bits */
+#define                 HEXIN_FLETCHER16_NMAX                   359             /* Words, sums of 65535 fit in 32 bits */
+#define                 HEXIN_FLETCHER_BLOCK                    32              /* Bytes per step of the AVX2 kernels */
+
+/*
+ * sums[0] += b[i], sums[1] += sums[0] for each byte, sums are reduced modulo modulus ( <= 256 ) on return.
+ */
+void hexin_fletcher_sum8( const unsigned char *pSrc, size_t len, unsigned int modulus, unsigned int sums[2] );
+
+/*
+ * The same on little-endian 16-bit words modulo 65535, a last odd byte is the low byte of a word.
+ */
+void hexin_fletcher_sum16( const unsigned char *pSrc, size_t len, unsigned int sums[2] );
+
+#endif //__HEXIN_FLETCHER_H__
@@ -0,0 +1,55 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_lock.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize.
+*
+*********************************************************************************************************
+*/
+
+#include "_hexin_lock.h"
+
+int hexin_lock_prepare( PyThread_type_lock *lock )
+{
+    if ( *lock == NULL ) {
+        *lock = PyThread_allocate_lock();
+        if ( *lock == NULL ) {
+            PyErr_NoMemory();
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void hexin_lock_acquire( PyThread_type_lock lock )
+{
+    if ( lock == NULL ) {
+        return;
+    }
+
+    if ( !PyThread_acquire_lock( lock, NOWAIT_LOCK ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( lock, WAIT_LOCK );
+        Py_END_ALLOW_THREADS
+    }
+}
+
+void hexin_lock_release( PyThread_type_lock lock )
+{
+    if ( lock != NULL ) {
+        PyThread_release_lock( lock );
+    }
+}
+
+void hexin_lock_free( PyThread_type_lock lock )
+{
+    if ( lock != NULL ) {
+        PyThread_free_lock( lock );
+    }
+}
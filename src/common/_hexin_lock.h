@@ -0,0 +1,39 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_lock.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize.
+*                       Lock of an incremental object ( libscrc.new(), Model.new() ), as the one of the hashlib objects.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_LOCK_H__
+#define __HEXIN_LOCK_H__
+
+#include <Python.h>
+#include <pythread.h>
+
+/*
+ * update() releases the GIL for large buffers, another thread may then update(), digest() or copy() the same object.
+ * The lock is built by the first update() that releases the GIL ( NULL before, nothing to wait for ), with the GIL held.
+ * hexin_lock_acquire() / _release() do nothing while it is NULL.
+ */
+
+/* Builds *lock when NULL, 0 with a MemoryError set. */
+int hexin_lock_prepare( PyThread_type_lock *lock );
+
+/* Called with the GIL, released while waiting for another thread. */
+void hexin_lock_acquire( PyThread_type_lock lock );
+
+void hexin_lock_release( PyThread_type_lock lock );
+
+void hexin_lock_free( PyThread_type_lock lock );
+
+#endif //__HEXIN_LOCK_H__
@@ -0,0 +1,689 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_module.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( was copied in _crc8/16/24/32/64/x/canxmodule.c ).
+*                       The Python glue of a module on the engine ( _hexin_core.h ), included once by _<module>module.c :
+*
+*                           #define HEXIN_MODULE_NAME           crc16               hexin_crc16_xxx(), _crc16_xxx()
+*                           #define HEXIN_MODULE_TYPE           unsigned short      The register
+*                           #define HEXIN_MODULE_BITS           16
+*                           #define HEXIN_MODULE_TITLE          "CRC16"
+*                           #define HEXIN_MODULE_HACKER         "hacker16"          Optional, the model built at runtime
+*                           #define HEXIN_MODULE_HACKER_PARAM   { FALSE, ... }      Its default descriptor
+*                           #include "_hexin_module.h"
+*
+*                       after HEXIN_GIL_RELEASE_MINSIZE and hexin_<module>_models[] ( name, param ) of libscrc.new().
+*                       Defines hexin_PyArg_ParseTuple_Paramete() of the model functions, the hash type of libscrc.new(),
+*                       _<module>_hacker(), _new(), _combine(), _batch(), _kernel() and HEXIN_MODULE_METHODS for the method table.
+*                       2022-06-15 [Heyn] _new(), _combine(), _batch() and _kernel() are METH_FASTCALL ( hexin_fastcall_parse() ), no format strings.
+*                       2022-06-15 [Heyn] threads=N ( >= 1 ) and chunk=N are range checked, no longer truncated to unsigned int.
+*                       2022-06-15 [Heyn] The hash objects have a lock, update() of two threads no longer loses one of them.
+*                       2022-06-15 [Heyn] _combine() operators built once per built-in model ( were one slot, rebuilt when the model changed ).
+*                       2022-06-15 [Heyn] _<module>_hacker() computes on the pinned cache entry, no copy of its tables.
+*                       2022-06-15 [Heyn] The hacker model of _new(), _combine() and _batch() uses the cache too, no tables built per call.
+*                       2022-06-15 [Heyn] Cache entries are marked built ( hexin_cache_built() ) once filled, a failed build is redone by the next call.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_MODULE_H__
+#define __HEXIN_MODULE_H__
+
+#include <string.h>
+#include <limits.h>
+#include "_hexin_cpu.h"
+#include "_hexin_pool.h"
+#include "_hexin_batch.h"
+#include "_hexin_fastcall.h"
+#include "_hexin_lock.h"
+#include "_hexin_cache.h"
+
+#endif //__HEXIN_MODULE_H__
+
+#if !defined( HEXIN_MODULE_NAME ) || !defined( HEXIN_MODULE_TYPE ) || !defined( HEXIN_MODULE_BITS ) || !defined( HEXIN_MODULE_TITLE )
+#error "_hexin_module.h needs HEXIN_MODULE_NAME, HEXIN_MODULE_TYPE, HEXIN_MODULE_BITS and HEXIN_MODULE_TITLE"
+#endif
+
+#define                 HEXIN_MODULE_STR( x )                   #x
+#define                 HEXIN_MODULE_XSTR( x )                  HEXIN_MODULE_STR( x )
+#define                 HEXIN_MODULE_FN( suffix )               HEXIN_CORE_XPASTE( hexin_, HEXIN_MODULE_NAME, suffix )
+#define                 HEXIN_MODULE_PY( suffix )               HEXIN_CORE_XPASTE( _, HEXIN_MODULE_NAME, suffix )
+#define                 HEXIN_MODULE_PARAM                      HEXIN_CORE_XPASTE( _hexin_, HEXIN_MODULE_NAME, )
+#define                 HEXIN_MODULE_TABLES                     HEXIN_CORE_XPASTE( _hexin_, HEXIN_MODULE_NAME, _tables )
+#define                 HEXIN_MODULE_COMBINE                    HEXIN_CORE_XPASTE( _hexin_, HEXIN_MODULE_NAME, _combine )
+#define                 HEXIN_MODULE_HASH                       HEXIN_MODULE_FN( _hash )
+#define                 HEXIN_MODULE_MODELS                     HEXIN_MODULE_FN( _models )
+
+#if HEXIN_MODULE_BITS > 32
+#define                 HEXIN_MODULE_PYLONG( x )                PyLong_FromUnsignedLongLong( x )
+#else
+#define                 HEXIN_MODULE_PYLONG( x )                hexin_PyLong_FromUnsigned( x )
+#endif
+
+#if defined( HEXIN_MODULE_HACKER )
+#define                 HEXIN_MODULE_NO_HACKER                  "%s takes no poly, init, xorout, refin or refout ( " HEXIN_MODULE_HACKER " does )"
+#else
+#define                 HEXIN_MODULE_NO_HACKER                  "%s takes no poly, init, xorout, refin or refout"
+#endif
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_ARGS, const struct HEXIN_MODULE_PARAM *param, HEXIN_MODULE_TYPE *result )
+{
+    Py_buffer data = { NULL, NULL };
+    unsigned int is_gradual = 0;
+    unsigned long long init = param->init;
+    unsigned long long threads = 1, chunk = HEXIN_POOL_MIN_CHUNK;
+    PyObject *values[4];
+    static const char* kwlist[]={ "data", "init", "threads", "chunk", NULL };
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[1], &init ) ||
+         !hexin_fastcall_bounded( values[2], UINT_MAX, &threads ) ||
+         !hexin_fastcall_bounded( values[3], UINT_MAX, &chunk ) ) {
+        return FALSE;
+    }
+
+    if ( threads < 1 ) {
+        PyErr_SetString( PyExc_ValueError, "threads must be >= 1" );
+        return FALSE;
+    }
+
+    if ( !hexin_fastcall_buffer( values[0], &data ) ) {
+        return FALSE;
+    }
+
+    /* Fixed Issues #4  : init ( positional or init=... ) goes on from a previous result */
+    is_gradual = ( values[1] != NULL ) ? 2 : 1;
+    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) {
+        init = ( init ^ param->xorout );
+    }
+
+    /* The tables are generated by setup.py, param is read-only here. */
+    if ( ( threads > 1 ) && ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = HEXIN_MODULE_FN( _compute_parallel )( (const unsigned char *)data.buf, (size_t)data.len, param, ( HEXIN_MODULE_TYPE )init, is_gradual,
+                                                        ( unsigned int )threads, ( unsigned int )chunk );
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = HEXIN_MODULE_FN( _compute )( (const unsigned char *)data.buf, (size_t)data.len, param, ( HEXIN_MODULE_TYPE )init, is_gradual );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = HEXIN_MODULE_FN( _compute )( (const unsigned char *)data.buf, (size_t)data.len, param, ( HEXIN_MODULE_TYPE )init, is_gradual );
+    }
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return TRUE;
+}
+
+#if defined( HEXIN_MODULE_HACKER )
+/* Tables ( and _combine() operators ) of the recent hacker models ( LRU ), the GIL protects the caches, a pinned entry stays valid without it. */
+static struct _hexin_cache HEXIN_MODULE_FN( _cache );
+static struct _hexin_cache HEXIN_MODULE_FN( _cache_combine );
+
+/* Pinned cache entry of the tables of hacker, built when new, hacker points at it. Release with hexin_cache_release(). */
+static struct HEXIN_MODULE_TABLES *HEXIN_MODULE_FN( _hacker_tables )( struct HEXIN_MODULE_PARAM *hacker )
+{
+    unsigned int is_built = FALSE;
+    struct HEXIN_MODULE_TABLES *tables = hexin_cache_lookup( &HEXIN_MODULE_FN( _cache ), hacker->width, hacker->poly, 0, hacker->refin, hacker->refout,
+                                                             sizeof( struct HEXIN_MODULE_TABLES ), FALSE, &is_built );
+
+    if ( tables == NULL ) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    hacker->is_initial = is_built;
+    if ( HEXIN_MODULE_FN( _compute_init )( hacker, tables ) ) {
+        hexin_cache_built( &HEXIN_MODULE_FN( _cache ), tables );
+    }
+    return tables;
+}
+
+static PyObject * HEXIN_MODULE_PY( _hacker )( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned int reinit = FALSE, is_built = FALSE;
+    Py_buffer data = { NULL, NULL };
+    static struct HEXIN_MODULE_PARAM hacker = HEXIN_MODULE_HACKER_PARAM;
+    struct HEXIN_MODULE_PARAM param;
+    struct HEXIN_MODULE_TABLES *tables = NULL;
+
+    HEXIN_MODULE_TYPE result = 0;
+    static const char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    unsigned int is_refin = hacker.refin, is_refout = hacker.refout;
+    unsigned long long poly = hacker.poly, init = hacker.init, xorout = hacker.xorout;
+    PyObject *values[7];
+
+    /* Like "y*|HHHppp", a parameter passed stays for the next calls. */
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[1], &poly   ) ||
+         !hexin_fastcall_unsigned( values[2], &init   ) ||
+         !hexin_fastcall_unsigned( values[3], &xorout ) ||
+         !hexin_fastcall_bool( values[4], &is_refin  ) ||
+         !hexin_fastcall_bool( values[5], &is_refout ) ||
+         !hexin_fastcall_bool( values[6], &reinit ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
+        return NULL;
+    }
+    hacker.poly   = ( HEXIN_MODULE_TYPE )poly;
+    hacker.init   = ( HEXIN_MODULE_TYPE )init;
+    hacker.xorout = ( HEXIN_MODULE_TYPE )xorout;
+    hacker.refin  = is_refin;
+    hacker.refout = is_refout;
+
+    /* The tables of the recent models stay built ( LRU ), reinit=True rebuilds the ones of this model. */
+    tables = hexin_cache_lookup( &HEXIN_MODULE_FN( _cache ), hacker.width, hacker.poly, 0, hacker.refin, hacker.refout,
+                                 sizeof( struct HEXIN_MODULE_TABLES ), reinit, &is_built );
+    if ( tables == NULL ) {
+        if ( data.obj )
+           PyBuffer_Release( &data );
+        return PyErr_NoMemory();
+    }
+    param = hacker;
+    param.is_initial = is_built;
+    if ( HEXIN_MODULE_FN( _compute_init )( &param, tables ) ) {
+        hexin_cache_built( &HEXIN_MODULE_FN( _cache ), tables );
+    }
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        /* The entry is pinned, no other thread evicts or rebuilds it. */
+        Py_BEGIN_ALLOW_THREADS
+        result = HEXIN_MODULE_FN( _compute )( (const unsigned char *)data.buf, (size_t)data.len, &param, param.init, FALSE );
+        Py_END_ALLOW_THREADS
+    } else {
+        result = HEXIN_MODULE_FN( _compute )( (const unsigned char *)data.buf, (size_t)data.len, &param, param.init, FALSE );
+    }
+    hexin_cache_release( &HEXIN_MODULE_FN( _cache ), tables );
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return HEXIN_MODULE_PYLONG( result );
+}
+#endif /* HEXIN_MODULE_HACKER */
+
+/*
+ * Incremental ( hashlib style ) objects of libscrc.new( name ).
+ * crc is the raw register of hexin_xxx_compute_start() / _update(), digest() applies _final().
+ * lock serializes update() / digest() / copy() of threads sharing an object, once an update() released the GIL ( _hexin_lock.h ).
+ */
+typedef struct {
+    PyObject_HEAD
+    const char                  *name;
+    struct HEXIN_MODULE_PARAM    param;
+#if defined( HEXIN_MODULE_HACKER )
+    struct HEXIN_MODULE_TABLES  *tables;                    /* hacker only, pinned cache entry, param points at it */
+#endif /* HEXIN_MODULE_HACKER */
+    HEXIN_MODULE_TYPE            crc;
+    PyThread_type_lock           lock;
+} HEXIN_MODULE_HASH;
+
+static PyTypeObject HEXIN_MODULE_FN( _hash_type ) = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+
+static HEXIN_MODULE_HASH *HEXIN_MODULE_FN( _hash_alloc )( const char *name, const struct HEXIN_MODULE_PARAM *param, HEXIN_MODULE_TYPE crc )
+{
+    HEXIN_MODULE_HASH *self = PyObject_New( HEXIN_MODULE_HASH, &HEXIN_MODULE_FN( _hash_type ) );
+
+    if ( self == NULL ) {
+        return NULL;
+    }
+    self->name   = name;
+    self->param  = *param;
+#if defined( HEXIN_MODULE_HACKER )
+    self->tables = NULL;
+#endif /* HEXIN_MODULE_HACKER */
+    self->crc    = crc;
+    self->lock   = NULL;
+    return self;
+}
+
+static void HEXIN_MODULE_FN( _hash_dealloc )( HEXIN_MODULE_HASH *self )
+{
+#if defined( HEXIN_MODULE_HACKER )
+    hexin_cache_release( &HEXIN_MODULE_FN( _cache ), self->tables );
+#endif /* HEXIN_MODULE_HACKER */
+    hexin_lock_free( self->lock );
+    PyObject_Del( self );
+}
+
+static unsigned char HEXIN_MODULE_FN( _hash_update_object )( HEXIN_MODULE_HASH *self, PyObject *object )
+{
+    Py_buffer data = { NULL, NULL };
+
+    if ( PyObject_GetBuffer( object, &data, PyBUF_SIMPLE ) < 0 ) {
+        return FALSE;
+    }
+
+    if ( ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) && !hexin_lock_prepare( &self->lock ) ) {
+        PyBuffer_Release( &data );
+        return FALSE;
+    }
+
+    hexin_lock_acquire( self->lock );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        self->crc = HEXIN_MODULE_FN( _compute_update )( (const unsigned char *)data.buf, (size_t)data.len, &self->param, self->crc );
+        Py_END_ALLOW_THREADS
+    } else {
+        self->crc = HEXIN_MODULE_FN( _compute_update )( (const unsigned char *)data.buf, (size_t)data.len, &self->param, self->crc );
+    }
+    hexin_lock_release( self->lock );
+
+    PyBuffer_Release( &data );
+    return TRUE;
+}
+
+/* The register, once an update() of another thread is done. */
+static HEXIN_MODULE_TYPE HEXIN_MODULE_FN( _hash_crc )( HEXIN_MODULE_HASH *self )
+{
+    HEXIN_MODULE_TYPE crc = 0;
+
+    hexin_lock_acquire( self->lock );
+    crc = self->crc;
+    hexin_lock_release( self->lock );
+    return crc;
+}
+
+static HEXIN_MODULE_TYPE HEXIN_MODULE_FN( _hash_value )( HEXIN_MODULE_HASH *self )
+{
+    HEXIN_MODULE_TYPE mask = ( HEXIN_MODULE_TYPE )( ~( HEXIN_MODULE_TYPE )0 ) >> ( HEXIN_MODULE_BITS - self->param.width );
+    return ( HEXIN_MODULE_TYPE )( HEXIN_MODULE_FN( _compute_final )( &self->param, HEXIN_MODULE_FN( _hash_crc )( self ) ) & mask );
+}
+
+static Py_ssize_t HEXIN_MODULE_FN( _hash_size )( HEXIN_MODULE_HASH *self )
+{
+    return ( Py_ssize_t )( ( self->param.width + 7 ) / 8 );
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_update )( HEXIN_MODULE_HASH *self, PyObject *args )
+{
+    PyObject *data = NULL;
+
+    if ( !PyArg_ParseTuple( args, "O", &data ) ) {
+        return NULL;
+    }
+    if ( !HEXIN_MODULE_FN( _hash_update_object )( self, data ) ) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_digest )( HEXIN_MODULE_HASH *self, PyObject *unused )
+{
+    unsigned char digest[8] = { 0 };
+    unsigned long long value = HEXIN_MODULE_FN( _hash_value )( self );
+    Py_ssize_t i = 0, size = HEXIN_MODULE_FN( _hash_size )( self );
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = ( unsigned char )( value & 0xFF );
+        value >>= 8;
+    }
+    return PyBytes_FromStringAndSize( ( const char * )digest, size );
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_hexdigest )( HEXIN_MODULE_HASH *self, PyObject *unused )
+{
+    static const char hex[] = "0123456789abcdef";
+    char digest[16] = { 0 };
+    unsigned long long value = HEXIN_MODULE_FN( _hash_value )( self );
+    Py_ssize_t i = 0, size = HEXIN_MODULE_FN( _hash_size )( self ) * 2;
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = hex[ value & 0x0F ];
+        value >>= 4;
+    }
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromStringAndSize( digest, size );
+#else
+    return PyString_FromStringAndSize( digest, size );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_intdigest )( HEXIN_MODULE_HASH *self, PyObject *unused )
+{
+    return HEXIN_MODULE_PYLONG( HEXIN_MODULE_FN( _hash_value )( self ) );
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_copy )( HEXIN_MODULE_HASH *self, PyObject *unused )
+{
+    HEXIN_MODULE_HASH *copy = HEXIN_MODULE_FN( _hash_alloc )( self->name, &self->param, HEXIN_MODULE_FN( _hash_crc )( self ) );
+
+    if ( copy == NULL ) {
+        return NULL;
+    }
+
+#if defined( HEXIN_MODULE_HACKER )
+    if ( self->tables != NULL ) {
+        copy->tables = HEXIN_MODULE_FN( _hacker_tables )( &copy->param );
+        if ( copy->tables == NULL ) {
+            Py_DECREF( copy );
+            return NULL;
+        }
+    }
+#endif /* HEXIN_MODULE_HACKER */
+    return ( PyObject * )copy;
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_get_name )( HEXIN_MODULE_HASH *self, void *closure )
+{
+    return Py_BuildValue( "s", self->name );
+}
+
+static PyObject * HEXIN_MODULE_FN( _hash_get_digest_size )( HEXIN_MODULE_HASH *self, void *closure )
+{
+    return Py_BuildValue( "n", HEXIN_MODULE_FN( _hash_size )( self ) );
+}
+
+static PyMethodDef HEXIN_MODULE_FN( _hash_methods )[] = {
+    { "update",    (PyCFunction)HEXIN_MODULE_FN( _hash_update ),    METH_VARARGS, "Update the CRC with the bytes of data" },
+    { "digest",    (PyCFunction)HEXIN_MODULE_FN( _hash_digest ),    METH_NOARGS,  "CRC of the data passed so far, as big-endian bytes" },
+    { "hexdigest", (PyCFunction)HEXIN_MODULE_FN( _hash_hexdigest ), METH_NOARGS,  "Like digest(), as a string of hexadecimal digits" },
+    { "intdigest", (PyCFunction)HEXIN_MODULE_FN( _hash_intdigest ), METH_NOARGS,  "Like digest(), as the integer the model function returns" },
+    { "copy",      (PyCFunction)HEXIN_MODULE_FN( _hash_copy ),      METH_NOARGS,  "Copy of the object, to share the CRC of a common prefix" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyGetSetDef HEXIN_MODULE_FN( _hash_getset )[] = {
+    { "name",        (getter)HEXIN_MODULE_FN( _hash_get_name ),        NULL, "Name of the CRC model", NULL },
+    { "digest_size", (getter)HEXIN_MODULE_FN( _hash_get_digest_size ), NULL, "Size of digest() in bytes", NULL },
+    { NULL, NULL, NULL, NULL, NULL }    /* Sentinel */
+};
+
+static int HEXIN_MODULE_FN( _hash_type_ready )( void )
+{
+    PyTypeObject *type = &HEXIN_MODULE_FN( _hash_type );
+
+    type->tp_name      = "libscrc._" HEXIN_MODULE_XSTR( HEXIN_MODULE_NAME ) "." HEXIN_MODULE_XSTR( HEXIN_MODULE_NAME ) "_hash";
+    type->tp_basicsize = sizeof( HEXIN_MODULE_HASH );
+    type->tp_dealloc   = ( destructor )HEXIN_MODULE_FN( _hash_dealloc );
+    type->tp_flags     = Py_TPFLAGS_DEFAULT;
+    type->tp_doc       = "Incremental " HEXIN_MODULE_TITLE " object, see libscrc.new()";
+    type->tp_methods   = HEXIN_MODULE_FN( _hash_methods );
+    type->tp_getset    = HEXIN_MODULE_FN( _hash_getset );
+    return PyType_Ready( type );
+}
+
+/* The built-in model called name ( hexin_xxx_models[] ), name is set to its static copy. NULL when not one of this module. */
+static const struct HEXIN_MODULE_PARAM *HEXIN_MODULE_FN( _model_lookup )( const char **name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; HEXIN_MODULE_MODELS[i].name != NULL; i++ ) {
+        if ( strcmp( HEXIN_MODULE_MODELS[i].name, *name ) == 0 ) {
+            *name = HEXIN_MODULE_MODELS[i].name;
+            return HEXIN_MODULE_MODELS[i].param;
+        }
+    }
+    return NULL;
+}
+
+#if defined( HEXIN_MODULE_HACKER )
+/* poly, init, xorout, refin and refout of the hacker model ( values[0..4], NULL when not passed ) like "BBBpp" / "HHHpp" ... */
+static unsigned char HEXIN_MODULE_FN( _hacker_parse )( PyObject **values, struct HEXIN_MODULE_PARAM *hacker )
+{
+    unsigned int is_refin = hacker->refin, is_refout = hacker->refout;
+    unsigned long long poly = hacker->poly, init = hacker->init, xorout = hacker->xorout;
+
+    if ( !hexin_fastcall_unsigned( values[0], &poly   ) ||
+         !hexin_fastcall_unsigned( values[1], &init   ) ||
+         !hexin_fastcall_unsigned( values[2], &xorout ) ||
+         !hexin_fastcall_bool( values[3], &is_refin  ) ||
+         !hexin_fastcall_bool( values[4], &is_refout ) ) {
+        return FALSE;
+    }
+    hacker->poly   = ( HEXIN_MODULE_TYPE )poly;
+    hacker->init   = ( HEXIN_MODULE_TYPE )init;
+    hacker->xorout = ( HEXIN_MODULE_TYPE )xorout;
+    hacker->refin  = is_refin;
+    hacker->refout = is_refout;
+    return TRUE;
+}
+#endif /* HEXIN_MODULE_HACKER */
+
+static PyObject * HEXIN_MODULE_PY( _new )( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    const char *name = NULL;
+    HEXIN_MODULE_HASH *hash = NULL;
+    const struct HEXIN_MODULE_PARAM *param = NULL;
+    static const char* kwlist[]={ "name", "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    PyObject *values[7];
+    Py_ssize_t count = hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values );
+
+    if ( ( count < 0 ) || !hexin_fastcall_string( values[0], &name ) ) {
+        return NULL;
+    }
+
+    param = HEXIN_MODULE_FN( _model_lookup )( &name );
+    if ( param != NULL ) {
+        if ( count > 2 ) {
+            PyErr_Format( PyExc_TypeError, HEXIN_MODULE_NO_HACKER, name );
+            return NULL;
+        }
+        hash = HEXIN_MODULE_FN( _hash_alloc )( name, param, HEXIN_MODULE_FN( _compute_start )( param, param->init, FALSE ) );
+#if defined( HEXIN_MODULE_HACKER )
+    } else if ( strcmp( name, HEXIN_MODULE_HACKER ) == 0 ) {
+        struct HEXIN_MODULE_PARAM hacker = HEXIN_MODULE_HACKER_PARAM;
+
+        if ( !HEXIN_MODULE_FN( _hacker_parse )( &values[2], &hacker ) ) {
+            return NULL;
+        }
+        hash = HEXIN_MODULE_FN( _hash_alloc )( HEXIN_MODULE_HACKER, &hacker, HEXIN_MODULE_FN( _compute_start )( &hacker, hacker.init, FALSE ) );
+        if ( hash == NULL ) {
+            return NULL;
+        }
+        hash->tables = HEXIN_MODULE_FN( _hacker_tables )( &hash->param );
+        if ( hash->tables == NULL ) {
+            Py_DECREF( hash );
+            return NULL;
+        }
+#endif /* HEXIN_MODULE_HACKER */
+    } else {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+
+    if ( hash == NULL ) {
+        return NULL;
+    }
+
+    if ( ( values[1] != NULL ) && ( values[1] != Py_None ) && !HEXIN_MODULE_FN( _hash_update_object )( hash, values[1] ) ) {
+        Py_DECREF( hash );
+        return NULL;
+    }
+    return ( PyObject * )hash;
+}
+
+/* Power-of-two operators of the built-in models, built by their first _combine() ( aliases share the slot of the first name ), the GIL protects them. */
+static struct HEXIN_MODULE_COMBINE *HEXIN_MODULE_FN( _combine_slots )[ sizeof( HEXIN_MODULE_MODELS ) / sizeof( HEXIN_MODULE_MODELS[0] ) ];
+
+static const struct HEXIN_MODULE_COMBINE *HEXIN_MODULE_FN( _combine_lookup )( const struct HEXIN_MODULE_PARAM *param )
+{
+    unsigned int i = 0;
+
+    for ( i=0; HEXIN_MODULE_MODELS[i].param != param; i++ );
+
+    if ( HEXIN_MODULE_FN( _combine_slots )[i] == NULL ) {
+        HEXIN_MODULE_FN( _combine_slots )[i] = PyMem_Malloc( sizeof( struct HEXIN_MODULE_COMBINE ) );
+        if ( HEXIN_MODULE_FN( _combine_slots )[i] == NULL ) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        HEXIN_MODULE_FN( _combine_init )( param, HEXIN_MODULE_FN( _combine_slots )[i] );
+    }
+    return HEXIN_MODULE_FN( _combine_slots )[i];
+}
+
+static PyObject * HEXIN_MODULE_PY( _combine )( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    const char *name = NULL;
+    unsigned long long crc1 = 0, crc2 = 0, len2 = 0;
+    HEXIN_MODULE_TYPE result = 0;
+    const struct HEXIN_MODULE_PARAM *param = NULL;
+    const struct HEXIN_MODULE_COMBINE *combine = NULL;
+    static const char* kwlist[]={ "name", "crc1", "crc2", "len2", "poly", "init", "xorout", "refin", "refout", NULL };
+    PyObject *values[9];
+    Py_ssize_t count = hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 4, values );
+
+    if ( ( count < 0 ) || !hexin_fastcall_string( values[0], &name ) ||
+         !hexin_fastcall_unsigned( values[1], &crc1 ) ||
+         !hexin_fastcall_unsigned( values[2], &crc2 ) ||
+         !hexin_fastcall_unsigned( values[3], &len2 ) ) {
+        return NULL;
+    }
+
+    param = HEXIN_MODULE_FN( _model_lookup )( &name );
+    if ( param != NULL ) {
+        if ( count > 4 ) {
+            PyErr_Format( PyExc_TypeError, HEXIN_MODULE_NO_HACKER, name );
+            return NULL;
+        }
+        combine = HEXIN_MODULE_FN( _combine_lookup )( param );
+        if ( combine == NULL ) {
+            return NULL;
+        }
+        result = HEXIN_MODULE_FN( _combine )( combine, ( HEXIN_MODULE_TYPE )crc1, ( HEXIN_MODULE_TYPE )crc2, len2 );
+#if defined( HEXIN_MODULE_HACKER )
+    } else if ( strcmp( name, HEXIN_MODULE_HACKER ) == 0 ) {
+        struct HEXIN_MODULE_PARAM hacker = HEXIN_MODULE_HACKER_PARAM;
+        unsigned int is_built = FALSE;
+        struct HEXIN_MODULE_TABLES *tables = NULL;
+        struct HEXIN_MODULE_COMBINE *operators = NULL;
+        HEXIN_MODULE_TYPE empty = 0;
+
+        if ( !HEXIN_MODULE_FN( _hacker_parse )( &values[4], &hacker ) ) {
+            return NULL;
+        }
+        operators = hexin_cache_lookup( &HEXIN_MODULE_FN( _cache_combine ), hacker.width, hacker.poly, 0, hacker.refin, hacker.refout,
+                                        sizeof( struct HEXIN_MODULE_COMBINE ), FALSE, &is_built );
+        if ( operators == NULL ) {
+            return PyErr_NoMemory();
+        }
+        if ( is_built == FALSE ) {
+            tables = HEXIN_MODULE_FN( _hacker_tables )( &hacker );
+            if ( tables == NULL ) {
+                /* Not marked built, the next call for this model builds the operators again. */
+                hexin_cache_release( &HEXIN_MODULE_FN( _cache_combine ), operators );
+                return NULL;
+            }
+            HEXIN_MODULE_FN( _combine_init )( &hacker, operators );
+            hexin_cache_built( &HEXIN_MODULE_FN( _cache_combine ), operators );
+            hexin_cache_release( &HEXIN_MODULE_FN( _cache ), tables );
+        }
+        /* The powers depend on ( width, poly, refin, refout ) only, empty ( the CRC of no data ) on init and xorout too. */
+        empty  = HEXIN_MODULE_FN( _compute_final )( &hacker, HEXIN_MODULE_FN( _compute_start )( &hacker, hacker.init, FALSE ) );
+        result = HEXIN_MODULE_FN( _combine )( operators, ( HEXIN_MODULE_TYPE )( crc1 ^ operators->empty ^ empty ), ( HEXIN_MODULE_TYPE )crc2, len2 );
+        hexin_cache_release( &HEXIN_MODULE_FN( _cache_combine ), operators );
+#endif /* HEXIN_MODULE_HACKER */
+    } else {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+
+    return HEXIN_MODULE_PYLONG( result );
+}
+
+static PyObject * HEXIN_MODULE_PY( _batch )( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    const char *name = NULL;
+    PyObject *result = NULL;
+    HEXIN_MODULE_TYPE *crc = NULL;
+    const struct HEXIN_MODULE_PARAM *param = NULL;
+    struct _hexin_batch batch;
+    static const char* kwlist[]={ "name", "data", "offsets", "poly", "init", "xorout", "refin", "refout", NULL };
+    PyObject *values[8];
+    Py_ssize_t count = hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 2, values );
+#if defined( HEXIN_MODULE_HACKER )
+    struct HEXIN_MODULE_PARAM hacker = HEXIN_MODULE_HACKER_PARAM;
+    struct HEXIN_MODULE_TABLES *tables = NULL;
+#endif /* HEXIN_MODULE_HACKER */
+
+    if ( ( count < 0 ) || !hexin_fastcall_string( values[0], &name ) ) {
+        return NULL;
+    }
+
+    param = HEXIN_MODULE_FN( _model_lookup )( &name );
+    if ( param != NULL ) {
+        if ( count > 3 ) {
+            PyErr_Format( PyExc_TypeError, HEXIN_MODULE_NO_HACKER, name );
+            return NULL;
+        }
+#if defined( HEXIN_MODULE_HACKER )
+    } else if ( strcmp( name, HEXIN_MODULE_HACKER ) == 0 ) {
+        if ( !HEXIN_MODULE_FN( _hacker_parse )( &values[3], &hacker ) ) {
+            return NULL;
+        }
+        tables = HEXIN_MODULE_FN( _hacker_tables )( &hacker );
+        if ( tables == NULL ) {
+            return NULL;
+        }
+        param = &hacker;
+#endif /* HEXIN_MODULE_HACKER */
+    } else {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+
+    if ( !hexin_batch_acquire( &batch, values[1], values[2] ) ) {
+#if defined( HEXIN_MODULE_HACKER )
+        hexin_cache_release( &HEXIN_MODULE_FN( _cache ), tables );
+#endif /* HEXIN_MODULE_HACKER */
+        return NULL;
+    }
+
+    /* Results in native byte order, libscrc.batch() wraps them in an array.array */
+    result = PyBytes_FromStringAndSize( NULL, ( Py_ssize_t )sizeof( HEXIN_MODULE_TYPE ) * batch.count );
+    if ( result != NULL ) {
+        crc = ( HEXIN_MODULE_TYPE * )PyBytes_AS_STRING( result );
+        if ( batch.total >= HEXIN_GIL_RELEASE_MINSIZE ) {
+            Py_BEGIN_ALLOW_THREADS
+            HEXIN_MODULE_FN( _compute_multi )( batch.pSrc, batch.len, ( size_t )batch.count, param, crc );
+            Py_END_ALLOW_THREADS
+        } else {
+            HEXIN_MODULE_FN( _compute_multi )( batch.pSrc, batch.len, ( size_t )batch.count, param, crc );
+        }
+    }
+
+    hexin_batch_release( &batch );
+#if defined( HEXIN_MODULE_HACKER )
+    hexin_cache_release( &HEXIN_MODULE_FN( _cache ), tables );
+#endif /* HEXIN_MODULE_HACKER */
+    return result;
+}
+
+/* The kernel of a model on this CPU ( capped by LIBSCRC_KERNEL ), use libscrc.kernel_for() */
+static PyObject * HEXIN_MODULE_PY( _kernel )( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    const char *name = NULL;
+    const struct HEXIN_MODULE_PARAM *param = NULL;
+    static const char* kwlist[]={ "name", NULL };
+    PyObject *values[1];
+#if defined( HEXIN_MODULE_HACKER )
+    struct HEXIN_MODULE_PARAM hacker = HEXIN_MODULE_HACKER_PARAM;
+#endif /* HEXIN_MODULE_HACKER */
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) || !hexin_fastcall_string( values[0], &name ) ) {
+        return NULL;
+    }
+
+    param = HEXIN_MODULE_FN( _model_lookup )( &name );
+#if defined( HEXIN_MODULE_HACKER )
+    if ( ( param == NULL ) && ( strcmp( name, HEXIN_MODULE_HACKER ) == 0 ) ) {
+        param = &hacker;            /* Its default model */
+    }
+#endif /* HEXIN_MODULE_HACKER */
+
+    if ( param == NULL ) {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+    return Py_BuildValue( "s", hexin_cpu_kernel_name( HEXIN_MODULE_FN( _compute_kernel )( param ) ) );
+}
+
+/* The entries of the method table used by libscrc.new() / combine() / batch() / kernel_for() */
+#define HEXIN_MODULE_METHODS                                                                                                                                      \
+    { "_new",     (PyCFunction)HEXIN_MODULE_PY( _new ),     HEXIN_METH_FASTCALL_KEYWORDS, "Incremental object of a model, use libscrc.new()" },                         \
+    { "_combine", (PyCFunction)HEXIN_MODULE_PY( _combine ), HEXIN_METH_FASTCALL_KEYWORDS, "CRC of A + B from CRC( A ), CRC( B ) and len( B ), use libscrc.combine()" }, \
+    { "_batch",   (PyCFunction)HEXIN_MODULE_PY( _batch ),   HEXIN_METH_FASTCALL_KEYWORDS, "CRC of many frames in one call, use libscrc.batch()" },                       \
+    { "_kernel",  (PyCFunction)HEXIN_MODULE_PY( _kernel ),  HEXIN_METH_FASTCALL_KEYWORDS, "The kernel of a model on this CPU, use libscrc.kernel_for()" }
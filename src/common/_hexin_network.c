@@ -0,0 +1,125 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_network.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-07 [Heyn] Initialize.
+*
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "_hexin_network.h"
+
+#if defined( HEXIN_X86_64 )
+#include <immintrin.h>
+#endif /* HEXIN_X86_64 */
+
+/*
+ * The sum of the 16-bit words is the same in any byte order ( RFC 1071 ), so the words are loaded
+ * 8 bytes at a time in the host order and folded at the end.
+ */
+static unsigned int __hexin_network_fold( unsigned long long sum )
+{
+    sum = ( sum & 0xFFFFFFFFULL ) + ( sum >> 32 );
+    sum = ( sum & 0xFFFFFFFFULL ) + ( sum >> 32 );
+    sum = ( sum & 0xFFFFULL ) + ( sum >> 16 );
+    sum = ( sum & 0xFFFFULL ) + ( sum >> 16 );
+    return ( unsigned int )sum;
+}
+
+/* One's complement 64-bit add, the carry goes around. */
+#define __HEXIN_NETWORK_ADD( acc, x )   { ( acc ) += ( x ); ( acc ) += ( ( acc ) < ( x ) ); }
+
+static unsigned long long __hexin_network_scalar( const unsigned char *pSrc, size_t len, unsigned long long sum )
+{
+    unsigned long long acc0 = sum, acc1 = 0;
+    unsigned long long x0 = 0, x1 = 0;
+    unsigned short last = 0;
+
+    while ( len >= 16 ) {
+        memcpy( &x0, pSrc,     8 );
+        memcpy( &x1, pSrc + 8, 8 );
+        __HEXIN_NETWORK_ADD( acc0, x0 );
+        __HEXIN_NETWORK_ADD( acc1, x1 );
+        pSrc += 16;
+        len  -= 16;
+    }
+    __HEXIN_NETWORK_ADD( acc0, acc1 );
+
+    while ( len >= 2 ) {
+        memcpy( &last, pSrc, 2 );
+        __HEXIN_NETWORK_ADD( acc0, ( unsigned long long )last );
+        pSrc += 2;
+        len  -= 2;
+    }
+
+    if ( len ) {
+        last = 0;
+        memcpy( &last, pSrc, 1 );       /* The first byte of a word, whatever the host order */
+        __HEXIN_NETWORK_ADD( acc0, ( unsigned long long )last );
+    }
+
+    return acc0;
+}
+
+#if defined( HEXIN_X86_64 )
+
+/*
+ * The 32-bit halves of each 64-bit lane are added into 64-bit lanes, 2 x 2^32 per lane and step,
+ * so the lanes can not overflow before 2^61 bytes.
+ */
+HEXIN_TARGET( "avx2" )
+static unsigned long long __hexin_network_avx2( const unsigned char *pSrc, size_t len, unsigned long long sum )
+{
+    const __m256i mask = _mm256_set1_epi64x( 0x00000000FFFFFFFFLL );
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+    unsigned long long lanes[4];
+    size_t i = 0;
+
+    while ( len >= HEXIN_NETWORK_BLOCK ) {
+        const __m256i v0 = _mm256_loadu_si256( ( const __m256i * )pSrc );
+        const __m256i v1 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 32 ) );
+
+        acc0 = _mm256_add_epi64( acc0, _mm256_and_si256( v0, mask ) );
+        acc1 = _mm256_add_epi64( acc1, _mm256_srli_epi64( v0, 32 ) );
+        acc0 = _mm256_add_epi64( acc0, _mm256_and_si256( v1, mask ) );
+        acc1 = _mm256_add_epi64( acc1, _mm256_srli_epi64( v1, 32 ) );
+        pSrc += HEXIN_NETWORK_BLOCK;
+        len  -= HEXIN_NETWORK_BLOCK;
+    }
+
+    _mm256_storeu_si256( ( __m256i * )lanes, _mm256_add_epi64( acc0, acc1 ) );
+    _mm256_zeroupper();
+    for ( i=0; i<4; i++ ) {
+        __HEXIN_NETWORK_ADD( sum, lanes[i] );
+    }
+
+    return __hexin_network_scalar( pSrc, len, sum );
+}
+
+#endif /* HEXIN_X86_64 */
+
+unsigned int hexin_network_sum( const unsigned char *pSrc, size_t len, unsigned int sum )
+{
+#if defined( HEXIN_X86_64 )
+    if ( ( len >= HEXIN_NETWORK_BLOCK ) && ( hexin_cpu_features() & HEXIN_CPU_AVX2 ) ) {
+        return __hexin_network_fold( __hexin_network_avx2( pSrc, len, sum ) );
+    }
+#endif /* HEXIN_X86_64 */
+    return __hexin_network_fold( __hexin_network_scalar( pSrc, len, sum ) );
+}
+
+unsigned short hexin_network_update( unsigned short checksum, const unsigned char *pOld, const unsigned char *pNew, size_t len )
+{
+    unsigned int sum = ( unsigned short )~checksum;
+
+    sum += ( unsigned short )~hexin_network_sum( pOld, len, 0 );
+    sum += hexin_network_sum( pNew, len, 0 );
+    return ( unsigned short )~__hexin_network_fold( sum );
+}
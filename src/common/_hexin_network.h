@@ -0,0 +1,36 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_network.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-07 [Heyn] Initialize.
+*                       Internet checksum ( RFC 1071 ) with 64-bit accumulators, AVX2 kernel, RFC 1624 update.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_NETWORK_H__
+#define __HEXIN_NETWORK_H__
+
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_NETWORK_BLOCK                     64              /* Bytes per step of the AVX2 kernel */
+
+/*
+ * One's complement sum of the 16-bit words of pSrc ( in memory order, a last odd byte is padded with zero )
+ * added to sum, folded to 16 bits and not inverted. The checksum is ~sum.
+ */
+unsigned int hexin_network_sum( const unsigned char *pSrc, size_t len, unsigned int sum );
+
+/*
+ * RFC 1624 eqn. 3 : HC' = ~( ~HC + ~m + m' ), the checksum after the field pOld[0..len) became pNew[0..len).
+ * The field starts at an even offset of the checksummed data.
+ */
+unsigned short hexin_network_update( unsigned short checksum, const unsigned char *pOld, const unsigned char *pNew, size_t len );
+
+#endif //__HEXIN_NETWORK_H__
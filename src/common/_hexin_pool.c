@@ -0,0 +1,205 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_pool.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-01 [Heyn] Initialize.
+*                       2022-06-15 [Heyn] pthread_atfork() child handler, the child of a fork() starts with no workers.
+*
+*********************************************************************************************************
+*/
+
+#include "_hexin_pool.h"
+
+#if defined( _WIN32 )
+#include <windows.h>
+typedef SRWLOCK                 hexin_mutex_t;
+typedef CONDITION_VARIABLE      hexin_cond_t;
+#define HEXIN_MUTEX_INITIALIZER SRWLOCK_INIT
+#define HEXIN_COND_INITIALIZER  CONDITION_VARIABLE_INIT
+#define hexin_mutex_lock(x)     AcquireSRWLockExclusive( x )
+#define hexin_mutex_unlock(x)   ReleaseSRWLockExclusive( x )
+#define hexin_cond_wait(c, m)   SleepConditionVariableSRW( c, m, INFINITE, 0 )
+#define hexin_cond_broadcast(c) WakeAllConditionVariable( c )
+#else
+#include <pthread.h>
+typedef pthread_mutex_t         hexin_mutex_t;
+typedef pthread_cond_t          hexin_cond_t;
+#define HEXIN_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#define HEXIN_COND_INITIALIZER  PTHREAD_COND_INITIALIZER
+#define hexin_mutex_lock(x)     pthread_mutex_lock( x )
+#define hexin_mutex_unlock(x)   pthread_mutex_unlock( x )
+#define hexin_cond_wait(c, m)   pthread_cond_wait( c, m )
+#define hexin_cond_broadcast(c) pthread_cond_broadcast( c )
+#endif /* _WIN32 */
+
+static struct {
+    hexin_mutex_t   lock;
+    hexin_cond_t    wake;               /* A new run for the workers */
+    hexin_cond_t    done;               /* The last job of a run is done */
+    unsigned int    workers;            /* Started, they never exit */
+    unsigned int    busy;
+    unsigned long   generation;         /* One per run */
+    hexin_pool_job  job;
+    void           *arg;
+    unsigned int    count;
+    unsigned int    next;               /* Next job index to take */
+    unsigned int    finished;
+    unsigned int    wanted;             /* Workers allowed in this run */
+    unsigned int    active;             /* Workers in this run */
+} hexin_pool = { HEXIN_MUTEX_INITIALIZER, HEXIN_COND_INITIALIZER, HEXIN_COND_INITIALIZER };
+
+/* Called with the lock held, takes the jobs left in the run. */
+static void hexin_pool_work( void )
+{
+    unsigned int index = 0;
+
+    while ( hexin_pool.next < hexin_pool.count ) {
+        index = hexin_pool.next++;
+        hexin_mutex_unlock( &hexin_pool.lock );
+        hexin_pool.job( hexin_pool.arg, index );
+        hexin_mutex_lock( &hexin_pool.lock );
+        hexin_pool.finished++;
+    }
+}
+
+#if defined( _WIN32 )
+static DWORD WINAPI hexin_pool_worker( LPVOID unused )
+#else
+static void *hexin_pool_worker( void *unused )
+#endif /* _WIN32 */
+{
+    unsigned long seen = 0;
+
+    hexin_mutex_lock( &hexin_pool.lock );
+    seen = hexin_pool.generation - 1;       /* Started by hexin_pool_run(), join its run */
+    for ( ;; ) {
+        while ( seen == hexin_pool.generation ) {
+            hexin_cond_wait( &hexin_pool.wake, &hexin_pool.lock );
+        }
+        seen = hexin_pool.generation;
+        if ( !hexin_pool.busy || ( hexin_pool.active >= hexin_pool.wanted ) ) {
+            continue;
+        }
+
+        hexin_pool.active++;
+        hexin_pool_work();
+        hexin_pool.active--;
+        if ( ( hexin_pool.finished == hexin_pool.count ) && ( hexin_pool.active == 0 ) ) {
+            hexin_cond_broadcast( &hexin_pool.done );
+        }
+    }
+#if defined( _WIN32 )
+    return 0;
+#else
+    return NULL;
+#endif /* _WIN32 */
+}
+
+static unsigned int hexin_pool_start( void )
+{
+#if defined( _WIN32 )
+    HANDLE thread = CreateThread( NULL, 0, hexin_pool_worker, NULL, 0, NULL );
+    if ( thread == NULL ) {
+        return 0;
+    }
+    CloseHandle( thread );
+#else
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    if ( pthread_attr_init( &attr ) != 0 ) {
+        return 0;
+    }
+    pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+    if ( pthread_create( &thread, &attr, hexin_pool_worker, NULL ) != 0 ) {
+        pthread_attr_destroy( &attr );
+        return 0;
+    }
+    pthread_attr_destroy( &attr );
+#endif /* _WIN32 */
+    return 1;
+}
+
+#if !defined( _WIN32 )
+/*
+ * Only the thread that called fork() goes on in the child : the workers are gone, the lock may be held by one of them.
+ * Start over, hexin_pool_run() spawns the workers again on the next run.
+ */
+static void hexin_pool_atfork_child( void )
+{
+    pthread_mutex_init( &hexin_pool.lock, NULL );
+    pthread_cond_init( &hexin_pool.wake, NULL );
+    pthread_cond_init( &hexin_pool.done, NULL );
+    hexin_pool.workers = 0;
+    hexin_pool.busy    = 0;
+    hexin_pool.active  = 0;
+}
+#endif /* _WIN32 */
+
+unsigned int hexin_pool_init( void )
+{
+#if !defined( _WIN32 )
+    static unsigned int registered = 0;
+
+    if ( !registered ) {
+        if ( pthread_atfork( NULL, NULL, hexin_pool_atfork_child ) != 0 ) {
+            return 0;
+        }
+        registered = 1;
+    }
+#endif /* _WIN32 */
+    return 1;
+}
+
+unsigned int hexin_pool_run( hexin_pool_job job, void *arg, unsigned int count, unsigned int threads )
+{
+    unsigned int i = 0;
+
+    if ( threads > HEXIN_POOL_MAX_THREADS ) {
+        threads = HEXIN_POOL_MAX_THREADS;
+    }
+    if ( threads > count ) {
+        threads = count;
+    }
+
+    hexin_mutex_lock( &hexin_pool.lock );
+    if ( hexin_pool.busy || ( threads <= 1 ) ) {
+        hexin_mutex_unlock( &hexin_pool.lock );
+        for ( i=0; i<count; i++ ) {
+            job( arg, i );
+        }
+        return 1;
+    }
+
+    while ( hexin_pool.workers < threads - 1 ) {
+        if ( !hexin_pool_start() ) {
+            break;
+        }
+        hexin_pool.workers++;
+    }
+
+    hexin_pool.busy     = 1;
+    hexin_pool.job      = job;
+    hexin_pool.arg      = arg;
+    hexin_pool.count    = count;
+    hexin_pool.next     = 0;
+    hexin_pool.finished = 0;
+    hexin_pool.wanted   = threads - 1;
+    hexin_pool.generation++;
+    hexin_cond_broadcast( &hexin_pool.wake );
+
+    hexin_pool_work();
+    while ( ( hexin_pool.finished < hexin_pool.count ) || ( hexin_pool.active != 0 ) ) {
+        hexin_cond_wait( &hexin_pool.done, &hexin_pool.lock );
+    }
+
+    hexin_pool.busy = 0;
+    hexin_mutex_unlock( &hexin_pool.lock );
+    return threads;
+}
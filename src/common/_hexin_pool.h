@@ -0,0 +1,50 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_pool.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-01 [Heyn] Initialize.
+*                       Persistent worker threads of the threads=N calls, started on first use and reused.
+*                       2022-06-15 [Heyn] One pool per process, it lives in libscrc._pool and the other extensions
+*                                         call it through the capsule libscrc._pool._C_API ( _hexin_poolapi.c ).
+*                       2022-06-15 [Heyn] New add hexin_pool_init(), the pool is reset in the child of a fork().
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_POOL_H__
+#define __HEXIN_POOL_H__
+
+#define                 HEXIN_POOL_MAX_THREADS                  64
+#define                 HEXIN_POOL_MIN_CHUNK                    ( 1024 * 1024 )     /* Default minimum bytes per thread */
+
+typedef void ( *hexin_pool_job )( void *arg, unsigned int index );
+
+/*
+ * Runs job( arg, 0 ) ... job( arg, count - 1 ) on the caller and at most threads - 1 pool workers, returns when all are done.
+ * Called without the GIL. When the pool is busy ( another thread is in hexin_pool_run ) the jobs run on the caller only.
+ */
+unsigned int hexin_pool_run( hexin_pool_job job, void *arg, unsigned int count, unsigned int threads );
+
+/* Called once by libscrc._pool at import, registers the fork() child handler ( pthread_atfork ). Returns 0 on failure. */
+unsigned int hexin_pool_init( void );
+
+#define                 HEXIN_POOL_CAPSULE                      "libscrc._pool._C_API"
+
+/* What libscrc._pool exports, the pool itself ( _hexin_pool.c ) is only linked into that extension. */
+struct _hexin_pool_api {
+    unsigned int ( *run )( hexin_pool_job job, void *arg, unsigned int count, unsigned int threads );
+};
+
+/*
+ * Binds hexin_pool_run() of an extension to the pool of libscrc._pool, called at import with the GIL.
+ * Returns 0 with an exception set when libscrc._pool can not be imported.
+ */
+int hexin_pool_import( void );
+
+#endif //__HEXIN_POOL_H__
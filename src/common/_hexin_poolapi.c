@@ -0,0 +1,43 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hexin_poolapi.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize.
+*                       hexin_pool_run() of the extensions, forwarded to the one pool of libscrc._pool.
+*
+*********************************************************************************************************
+*/
+
+#include <Python.h>
+#include "_hexin_pool.h"
+
+static const struct _hexin_pool_api *hexin_pool_api = NULL;
+
+int hexin_pool_import( void )
+{
+    if ( hexin_pool_api == NULL ) {
+        hexin_pool_api = ( const struct _hexin_pool_api * )PyCapsule_Import( HEXIN_POOL_CAPSULE, 0 );
+    }
+    return ( hexin_pool_api != NULL );
+}
+
+unsigned int hexin_pool_run( hexin_pool_job job, void *arg, unsigned int count, unsigned int threads )
+{
+    unsigned int i = 0;
+
+    if ( hexin_pool_api != NULL ) {
+        return hexin_pool_api->run( job, arg, count, threads );
+    }
+
+    /* Not imported ( yet ), the jobs run on the caller. */
+    for ( i=0; i<count; i++ ) {
+        job( arg, i );
+    }
+    return 1;
+}
@@ -0,0 +1,49 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc16models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc16 of _crc16module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc16gentables.h ) and by _crc16module.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly    init    refin   refout  xorout */
+HEXIN_MODEL( crc16_param_modbus,           16,    0x8005, 0xFFFF, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_usb,              16,    0x8005, 0xFFFF, TRUE,   TRUE,   0xFFFF )
+HEXIN_MODEL( crc16_param_ibm,              16,    0x8005, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_xmodem,           16,    0x1021, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_ccitt_false,      16,    0x1021, 0xFFFF, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_ccitt_aug,        16,    0x1021, 0x1D0F, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_kermit,           16,    0x1021, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_mcrf4xx,          16,    0x1021, 0xFFFF, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_x25,              16,    0x1021, 0xFFFF, TRUE,   TRUE,   0xFFFF )
+HEXIN_MODEL( crc16_param_dnp,              16,    0x3D65, 0x0000, TRUE,   TRUE,   0xFFFF )
+HEXIN_MODEL( crc16_param_maxim,            16,    0x8005, 0x0000, TRUE,   TRUE,   0xFFFF )
+HEXIN_MODEL( crc16_param_dectr,            16,    0x0589, 0x0000, FALSE,  FALSE,  0x0001 )
+HEXIN_MODEL( crc16_param_dectx,            16,    0x0589, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_epc16,            16,    0x1021, 0xFFFF, FALSE,  FALSE,  0xFFFF )
+HEXIN_MODEL( crc16_param_profibus,         16,    0x1DCF, 0xFFFF, FALSE,  FALSE,  0xFFFF )
+HEXIN_MODEL( crc16_param_buypass,          16,    0x8005, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_gsm16,            16,    0x1021, 0x0000, FALSE,  FALSE,  0xFFFF )
+HEXIN_MODEL( crc16_param_riello,           16,    0x1021, 0xB2AA, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_crc16a,           16,    0x1021, 0xC6C6, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_cdma2000,         16,    0xC867, 0xFFFF, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_teledisk,         16,    0xA097, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_tms37157,         16,    0x1021, 0x89EC, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_en13757,          16,    0x3D65, 0x0000, FALSE,  FALSE,  0xFFFF )
+HEXIN_MODEL( crc16_param_t10_dif,          16,    0x8BB7, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_dds_110,          16,    0x8005, 0x800D, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_cms16,            16,    0x8005, 0xFFFF, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_lj1200,           16,    0x6F63, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_nrsc5,            16,    0x080B, 0xFFFF, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc16_param_opensafety_a,     16,    0x5935, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc16_param_opensafety_b,     16,    0x755B, 0x0000, FALSE,  FALSE,  0x0000 )
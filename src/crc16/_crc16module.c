@@ -29,326 +29,305 @@
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2020-11-18 [Heyn] Fixed (Python2) Parsing arguments has no 'p' type
 *                       2021-06-07 [Heyn] Add hacker16() reinit parameter. reinit=True -> Reinitialize the table
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-04 [Heyn] batch() uses the multi-buffer kernel hexin_xxx_compute_multi().
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-07 [Heyn] udp/tcp sum with 64-bit accumulators ( AVX2 kernel ), new add udp_update/tcp_update ( RFC 1624 ).
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, hacker16() tables are the ones of the engine ( slicing-by-8 ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc16models.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 *********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crc16tables.h"
+#include "_crc16gentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc16models.h ), the tables are the ones generated by setup.py ( _crc16gentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc16 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crc16models.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc16 *param;
+} hexin_crc16_models[] = {
+    { "modbus",       &crc16_param_modbus },
+    { "usb16",        &crc16_param_usb },
+    { "ibm",          &crc16_param_ibm },
+    { "arc",          &crc16_param_ibm },
+    { "lha",          &crc16_param_ibm },
+    { "xmodem",       &crc16_param_xmodem },
+    { "zmodem",       &crc16_param_xmodem },
+    { "acorn",        &crc16_param_xmodem },
+    { "v41_msb",      &crc16_param_xmodem },
+    { "lte16",        &crc16_param_xmodem },
+    { "ccitt_aug",    &crc16_param_ccitt_aug },
+    { "spi_fujitsu",  &crc16_param_ccitt_aug },
+    { "ccitt_false",  &crc16_param_ccitt_false },
+    { "ibm_3740",     &crc16_param_ccitt_false },
+    { "autosar16",    &crc16_param_ccitt_false },
+    { "kermit",       &crc16_param_kermit },
+    { "ccitt_true",   &crc16_param_kermit },
+    { "ccitt",        &crc16_param_kermit },
+    { "v41_lsb",      &crc16_param_kermit },
+    { "mcrf4xx",      &crc16_param_mcrf4xx },
+    { "dnp",          &crc16_param_dnp },
+    { "x25",          &crc16_param_x25 },
+    { "ibm_sdlc",     &crc16_param_x25 },
+    { "iso_hdlc16",   &crc16_param_x25 },
+    { "iec14443_3_b", &crc16_param_x25 },
+    { "maxim16",      &crc16_param_maxim },
+    { "dect_r",       &crc16_param_dectr },
+    { "dect_x",       &crc16_param_dectx },
+    { "epc16",        &crc16_param_epc16 },
+    { "profibus",     &crc16_param_profibus },
+    { "buypass",      &crc16_param_buypass },
+    { "umts",         &crc16_param_buypass },
+    { "verifone",     &crc16_param_buypass },
+    { "genibus",      &crc16_param_epc16 },
+    { "darc",         &crc16_param_epc16 },
+    { "epc_c1g2",     &crc16_param_epc16 },
+    { "icode16",      &crc16_param_epc16 },
+    { "gsm16",        &crc16_param_gsm16 },
+    { "riello",       &crc16_param_riello },
+    { "crc16_a",      &crc16_param_crc16a },
+    { "iec14443_3_a", &crc16_param_crc16a },
+    { "cdma2000",     &crc16_param_cdma2000 },
+    { "teledisk",     &crc16_param_teledisk },
+    { "tms37157",     &crc16_param_tms37157 },
+    { "en13757",      &crc16_param_en13757 },
+    { "t10_dif",      &crc16_param_t10_dif },
+    { "dds_110",      &crc16_param_dds_110 },
+    { "cms",          &crc16_param_cms16 },
+    { "lj1200",       &crc16_param_lj1200 },
+    { "nrsc5",        &crc16_param_nrsc5 },
+    { "opensafety_a", &crc16_param_opensafety_a },
+    { "opensafety_b", &crc16_param_opensafety_b },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#define                 HEXIN_MODULE_NAME                       crc16
+#define                 HEXIN_MODULE_TYPE                       unsigned short
+#define                 HEXIN_MODULE_BITS                       16
+#define                 HEXIN_MODULE_TITLE                      "CRC16"
+#define                 HEXIN_MODULE_HACKER                     "hacker16"
+#define                 HEXIN_MODULE_HACKER_PARAM               { .is_initial = FALSE,                     \
+                                                                  .width  = HEXIN_CRC16_WIDTH,              \
+                                                                  .poly   = CRC16_POLYNOMIAL_8005,          \
+                                                                  .init   = 0xFFFF,                         \
+                                                                  .refin  = TRUE,                           \
+                                                                  .refout = TRUE,                           \
+                                                                  .xorout = 0x0000 }
+#include "_hexin_module.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS,
                                              unsigned short init,
                                              unsigned short (*function)( const unsigned char *,
-                                                                         unsigned int,
+                                                                         size_t,
                                                                          unsigned short ),
                                              unsigned short *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned long long value = init;
+    PyObject *values[2];
+    static const char* kwlist[]={ "data", "init", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
-
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc16 *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned short init = param->init;          /* Fixed Issues #4  */
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_NOKW_PASS, NULL, kwlist, 1, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[1], &value ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned short )value;
 
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
     }
 
-    param->result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
     if ( data.obj )
        PyBuffer_Release( &data );
 
     return TRUE;
 }
 
-static PyObject * _crc16_modbus( PyObject *self, PyObject *args )
+static PyObject * _crc16_modbus( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_modbus = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_8005,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_modbus ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_modbus, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_modbus.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_usb( PyObject *self, PyObject *args )
+static PyObject * _crc16_usb( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_usb = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0xFFFF,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_usb ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_usb, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_usb.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_ibm( PyObject *self, PyObject *args )
+static PyObject * _crc16_ibm( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_ibm = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ibm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_ibm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ibm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_xmodem( PyObject *self, PyObject *args )
+static PyObject * _crc16_xmodem( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_xmodem = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_xmodem ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_xmodem, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_xmodem.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 
-static PyObject * _crc16_ccitt( PyObject *self, PyObject *args )
+static PyObject * _crc16_ccitt( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_false = { .is_initial=FALSE,
-                                                           .width  = HEXIN_CRC16_WIDTH,
-                                                           .poly   = CRC16_POLYNOMIAL_1021,
-                                                           .init   = 0xFFFF,
-                                                           .refin  = FALSE,
-                                                           .refout = FALSE,
-                                                           .xorout = 0x0000,
-                                                           .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_false ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_ccitt_false, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_false.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_ccitt_aug( PyObject *self, PyObject *args )
+static PyObject * _crc16_ccitt_aug( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_aug = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC16_WIDTH,
-                                                         .poly   = CRC16_POLYNOMIAL_1021,
-                                                         .init   = 0x1D0F,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x0000,
-                                                         .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_aug ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_ccitt_aug, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_aug.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_kermit( PyObject *self, PyObject *args )
+static PyObject * _crc16_kermit( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_kermit = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_kermit ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_kermit, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_kermit.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_mcrf4xx( PyObject *self, PyObject *args )
+static PyObject * _crc16_mcrf4xx( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_mcrf4xx = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_1021,
-                                                       .init   = 0xFFFF,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_mcrf4xx ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_mcrf4xx, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_mcrf4xx.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_x25( PyObject *self, PyObject *args )
+static PyObject * _crc16_x25( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_x25 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_1021,
-                                                   .init   = 0xFFFF,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_x25 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_x25, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_x25.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_sick( PyObject *self, PyObject *args )
+static PyObject * _crc16_sick( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned short result = 0x0000;
     unsigned short init   = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_dnp( PyObject *self, PyObject *args )
+static PyObject * _crc16_dnp( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_dnp = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_3D65,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dnp ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_dnp, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dnp.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_maxim( PyObject *self, PyObject *args )
+static PyObject * _crc16_maxim( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_maxim = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0x0000,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_maxim, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_maxim.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_dect_r( PyObject *self, PyObject *args )
+static PyObject * _crc16_dect_r( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_dectr = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0001,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectr ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_dectr, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectr.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_dect_x( PyObject *self, PyObject *args )
+static PyObject * _crc16_dect_x( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_dectx = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectx ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_dectx, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectx.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 static PyObject * _crc16_table( PyObject *self, PyObject *args )
@@ -370,7 +349,7 @@ static PyObject * _crc16_table( PyObject *self, PyObject *args )
     if ( FALSE == ref ) {
         hexin_crc16_init_table_poly_is_low ( poly, table );
     } else {
-        hexin_crc16_init_table_poly_is_high( hexin_reverse16( poly ), table );
+        hexin_crc16_init_table_poly_is_high( hexin_crc16_reverse( poly ), table );
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
@@ -380,422 +359,284 @@ static PyObject * _crc16_table( PyObject *self, PyObject *args )
     return plist;
 }
 
-static PyObject * _crc16_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc16_network( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc16 crc16_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_8005,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    unsigned short result   = 0x0000;
+    unsigned short reserved = 0x0000;
+ 
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
+        return NULL;
+    }
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|HHHppp", kwlist, &data,
-                                                                       &crc16_param_hacker.poly,
-                                                                       &crc16_param_hacker.init,
-                                                                       &crc16_param_hacker.xorout,
-                                                                       &crc16_param_hacker.refin,
-                                                                       &crc16_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    return hexin_PyLong_FromUnsigned( result );
+}
+
+static PyObject * _crc16_network_update( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned long long checksum = 0;
+    unsigned short result = 0x0000;
+    Py_buffer old = { NULL, NULL }, new = { NULL, NULL };
+    PyObject *values[3];
+    static const char* kwlist[]={ "checksum", "old", "new", NULL };
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 3, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[0], &checksum ) ||
+         !hexin_fastcall_buffer( values[1], &old ) ) {
         return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|HHHIII", kwlist, &data,
-                                                                       &crc16_param_hacker.poly,
-                                                                       &crc16_param_hacker.init,
-                                                                       &crc16_param_hacker.xorout,
-                                                                       &crc16_param_hacker.refin,
-                                                                       &crc16_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( !hexin_fastcall_buffer( values[2], &new ) ) {
+        PyBuffer_Release( &old );
         return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
 
-    crc16_param_hacker.is_initial = ( reinit == FALSE ) ? crc16_param_hacker.is_initial : FALSE;
-    crc16_param_hacker.result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc16_param_hacker, crc16_param_hacker.init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( old.len != new.len ) {
+        PyErr_Format( PyExc_ValueError, "old and new must be the same field, %zd != %zd bytes", old.len, new.len );
+    } else {
+        result = hexin_network_update( ( unsigned short )checksum, (const unsigned char *)old.buf,
+                                                                   (const unsigned char *)new.buf, (size_t)old.len );
+    }
 
-    return Py_BuildValue( "H", crc16_param_hacker.result );
-}
+    PyBuffer_Release( &old );
+    PyBuffer_Release( &new );
 
-static PyObject * _crc16_network( PyObject *self, PyObject *args )
-{
-    unsigned short result   = 0x0000;
-    unsigned short reserved = 0x0000;
- 
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
+    if ( PyErr_Occurred() ) {
         return NULL;
     }
-
-    return Py_BuildValue( "H", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc16_fletcher( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
-    unsigned short result   = 0x0000;
-    unsigned short reserved = 0x0000;
+    unsigned short result = 0x0000;
+    unsigned short init   = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_rfid_epc( PyObject *self, PyObject *args )
+static PyObject * _crc16_rfid_epc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_epc16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_epc16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_epc16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_epc16.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_profibus( PyObject *self, PyObject *args )
+static PyObject * _crc16_profibus( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_profibus = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC16_WIDTH,
-                                                        .poly   = CRC16_POLYNOMIAL_1DCF,
-                                                        .init   = 0xFFFF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0xFFFF,
-                                                        .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_profibus ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_profibus, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_profibus.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_buypass( PyObject *self, PyObject *args )
+static PyObject * _crc16_buypass( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_buypass = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_buypass ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_buypass, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_buypass.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_gsm16( PyObject *self, PyObject *args )
+static PyObject * _crc16_gsm16( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_gsm16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_gsm16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_gsm16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_gsm16.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_riello( PyObject *self, PyObject *args )
+static PyObject * _crc16_riello( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_riello = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xB2AA,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_riello ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_riello, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_riello.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_crc16_a( PyObject *self, PyObject *args )
+static PyObject * _crc16_crc16_a( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_crc16a = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xC6C6,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_crc16a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_crc16a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_crc16a.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_cdma2000( PyObject *self, PyObject *args )
+static PyObject * _crc16_cdma2000( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_cdma2000 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_C867,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cdma2000.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_teledisk( PyObject *self, PyObject *args )
+static PyObject * _crc16_teledisk( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_teledisk = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0xA097,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_teledisk ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_teledisk, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_teledisk.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_tms37157( PyObject *self, PyObject *args )
+static PyObject * _crc16_tms37157( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_tms37157 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x89EC,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_tms37157 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_tms37157, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_tms37157.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_en13757( PyObject *self, PyObject *args )
+static PyObject * _crc16_en13757( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_en13757 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_3D65,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0xFFFF,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_en13757 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_en13757, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_en13757.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_t10_dif( PyObject *self, PyObject *args )
+static PyObject * _crc16_t10_dif( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_t10_dif = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = 0x8BB7,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_t10_dif ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_t10_dif, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_t10_dif.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_dds_110( PyObject *self, PyObject *args )
+static PyObject * _crc16_dds_110( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_dds_110 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x800D,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dds_110 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_dds_110, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dds_110.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_cms( PyObject *self, PyObject *args )
+static PyObject * _crc16_cms( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_cms16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cms16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_cms16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cms16.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_lj1200( PyObject *self, PyObject *args )
+static PyObject * _crc16_lj1200( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_lj1200 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0x6F63,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_lj1200 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_lj1200, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_lj1200.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_nrsc5( PyObject *self, PyObject *args )
+static PyObject * _crc16_nrsc5( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_nrsc5 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = 0x080B,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_nrsc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_nrsc5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_nrsc5.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_opensafety_a( PyObject *self, PyObject *args )
+static PyObject * _crc16_opensafety_a( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_a = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x5935,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_opensafety_a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_a.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc16_opensafety_b( PyObject *self, PyObject *args )
+static PyObject * _crc16_opensafety_b( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_b = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x755B,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_b ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc16_param_opensafety_b, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_b.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 /* method table */
 static PyMethodDef _crc16Methods[] = {
-    { "modbus",      (PyCFunction)_crc16_modbus,    METH_VARARGS, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "usb16",       (PyCFunction)_crc16_usb,       METH_VARARGS, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "arc",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "lha",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "xmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "zmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "acorn",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "v41_msb",     (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "lte16",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_false", (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "ibm_3740",    (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "autosar16",   (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "kermit",      (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt_true",  (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt",       (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "v41_lsb",     (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,   METH_VARARGS, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "sick",        (PyCFunction)_crc16_sick,      METH_VARARGS, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
-    { "dnp",         (PyCFunction)_crc16_dnp,       METH_VARARGS, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "x25",         (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm_sdlc",    (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iso_hdlc16",  (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iec14443_3_b",(PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "maxim16",     (PyCFunction)_crc16_maxim,     METH_VARARGS, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
-    { "dect_r",      (PyCFunction)_crc16_dect_r,    METH_VARARGS, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
-    { "dect_x",      (PyCFunction)_crc16_dect_x,    METH_VARARGS, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "table16",     (PyCFunction)_crc16_table,     METH_VARARGS, "Print CRC16 table to list. libscrc.table16( polynomial )" },
-    { "hacker16",    (PyCFunction)_crc16_hacker,    METH_KEYWORDS|METH_VARARGS, "User calculation CRC16\n"
+    { "modbus",      (PyCFunction)_crc16_modbus,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "usb16",       (PyCFunction)_crc16_usb,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm",         (PyCFunction)_crc16_ibm,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "arc",         (PyCFunction)_crc16_ibm,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "lha",         (PyCFunction)_crc16_ibm,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "xmodem",      (PyCFunction)_crc16_xmodem,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "zmodem",      (PyCFunction)_crc16_xmodem,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "acorn",       (PyCFunction)_crc16_xmodem,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "v41_msb",     (PyCFunction)_crc16_xmodem,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "lte16",       (PyCFunction)_crc16_xmodem,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_false", (PyCFunction)_crc16_ccitt,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "ibm_3740",    (PyCFunction)_crc16_ccitt,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "autosar16",   (PyCFunction)_crc16_ccitt,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "kermit",      (PyCFunction)_crc16_kermit,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt_true",  (PyCFunction)_crc16_kermit,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt",       (PyCFunction)_crc16_kermit,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "v41_lsb",     (PyCFunction)_crc16_kermit,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "sick",        (PyCFunction)_crc16_sick,              HEXIN_METH_FASTCALL, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
+    { "dnp",         (PyCFunction)_crc16_dnp,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "x25",         (PyCFunction)_crc16_x25,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm_sdlc",    (PyCFunction)_crc16_x25,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iso_hdlc16",  (PyCFunction)_crc16_x25,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iec14443_3_b",(PyCFunction)_crc16_x25,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "maxim16",     (PyCFunction)_crc16_maxim,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
+    { "dect_r",      (PyCFunction)_crc16_dect_r,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
+    { "dect_x",      (PyCFunction)_crc16_dect_x,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "table16",     (PyCFunction)_crc16_table,             METH_VARARGS, "Print CRC16 table to list. libscrc.table16( polynomial )" },
+    { "hacker16",    (PyCFunction)_crc16_hacker,            HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC16\n"
                                                                                 "@data   : bytes\n"
                                                                                 "@poly   : default=0x8050\n"
                                                                                 "@init   : default=0xFFFF\n"
@@ -803,34 +644,37 @@ static PyMethodDef _crc16Methods[] = {
                                                                                 "@refin  : default=True\n"
                                                                                 "@refout : default=True\n"
                                                                                 "@reinit : default=False" },
-    { "udp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate UDP checksum." },
-    { "tcp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate TCP checksum." },
-    { "fletcher16",  (PyCFunction)_crc16_fletcher,   METH_VARARGS, "Calculate FLETCHER16" },
-    { "epc16",       (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "profibus",    (PyCFunction)_crc16_profibus,   METH_VARARGS, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "buypass",     (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "umts",        (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "verifone",    (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "genibus",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "darc",        (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "icode16",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "gsm16",       (PyCFunction)_crc16_gsm16,      METH_VARARGS, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "riello",      (PyCFunction)_crc16_riello,     METH_VARARGS, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
-    { "crc16_a",     (PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "cdma2000",    (PyCFunction)_crc16_cdma2000,   METH_VARARGS, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "teledisk",    (PyCFunction)_crc16_teledisk,   METH_VARARGS, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "tms37157",    (PyCFunction)_crc16_tms37157,   METH_VARARGS, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
-    { "en13757",     (PyCFunction)_crc16_en13757,    METH_VARARGS, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "t10_dif",     (PyCFunction)_crc16_t10_dif,    METH_VARARGS, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "dds_110",     (PyCFunction)_crc16_dds_110,    METH_VARARGS, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
-    { "cms",         (PyCFunction)_crc16_cms,        METH_VARARGS, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "lj1200",      (PyCFunction)_crc16_lj1200,     METH_VARARGS, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "nrsc5",       (PyCFunction)_crc16_nrsc5,      METH_VARARGS, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "udp",         (PyCFunction)_crc16_network,           HEXIN_METH_FASTCALL, "Calculate UDP checksum." },
+    { "tcp",         (PyCFunction)_crc16_network,           HEXIN_METH_FASTCALL, "Calculate TCP checksum." },
+    { "udp_update",  (PyCFunction)_crc16_network_update,    HEXIN_METH_FASTCALL_KEYWORDS, "UDP checksum after a field changed ( RFC 1624 ). libscrc.udp_update( checksum, old, new )" },
+    { "tcp_update",  (PyCFunction)_crc16_network_update,    HEXIN_METH_FASTCALL_KEYWORDS, "TCP checksum after a field changed ( RFC 1624 ). libscrc.tcp_update( checksum, old, new )" },
+    { "fletcher16",  (PyCFunction)_crc16_fletcher,          HEXIN_METH_FASTCALL, "Calculate FLETCHER16. libscrc.fletcher16( data, value=0 ), value goes on from a previous result" },
+    { "epc16",       (PyCFunction)_crc16_rfid_epc,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "profibus",    (PyCFunction)_crc16_profibus,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "buypass",     (PyCFunction)_crc16_buypass,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "umts",        (PyCFunction)_crc16_buypass,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "verifone",    (PyCFunction)_crc16_buypass,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "genibus",     (PyCFunction)_crc16_rfid_epc,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "darc",        (PyCFunction)_crc16_rfid_epc,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "icode16",     (PyCFunction)_crc16_rfid_epc,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "gsm16",       (PyCFunction)_crc16_gsm16,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "riello",      (PyCFunction)_crc16_riello,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
+    { "crc16_a",     (PyCFunction)_crc16_crc16_a,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "cdma2000",    (PyCFunction)_crc16_cdma2000,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "teledisk",    (PyCFunction)_crc16_teledisk,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "tms37157",    (PyCFunction)_crc16_tms37157,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
+    { "en13757",     (PyCFunction)_crc16_en13757,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "t10_dif",     (PyCFunction)_crc16_t10_dif,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "dds_110",     (PyCFunction)_crc16_dds_110,           HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
+    { "cms",         (PyCFunction)_crc16_cms,               HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "lj1200",      (PyCFunction)_crc16_lj1200,            HEXIN_METH_FASTCALL_KEYWORDS, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "nrsc5",       (PyCFunction)_crc16_nrsc5,             HEXIN_METH_FASTCALL_KEYWORDS, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
     
-    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   METH_VARARGS, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   METH_VARARGS, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -862,6 +706,7 @@ PyDoc_STRVAR( _crc16_doc,
 "libscrc.dect_x     -> Calculate DECT-X of CRC16              [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]\n"
 "libscrc.hacker16   -> Free calculation CRC16 @reinit reinitialize the crc16 tables\n"
 "libscrc.fletcher16 -> Calculate FLETCHER16\n"
+"libscrc.udp_update -> UDP/TCP checksum after the field old ( at an even offset ) became new, RFC 1624\n"
 "libscrc.epc16      -> Calculate RFID EPC of CRC16           [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]\n"
 "libscrc.profibus   -> Calculate PROFIBUS [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]\n"
 "libscrc.buypass    -> Calculate BUYPASS  [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]\n"
@@ -906,6 +751,18 @@ PyInit__crc16( void )
 {
     PyObject *m;
 
+    if ( hexin_crc16_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc16_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crc16module );
     if (m == NULL) {
         return NULL;
@@ -923,6 +780,14 @@ PyInit__crc16( void )
 PyMODINIT_FUNC
 init_crc16( void )
 {
+    if ( hexin_crc16_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc16_compute() may run without the GIL. */
+    hexin_cpu_features();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     (void) Py_InitModule3( "_crc16", _crc16Methods, _crc16_doc );
 }
 
@@ -16,93 +16,26 @@
 *                       2020-04-27 [Heyn] Optimized code.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
+*                       2022-05-11 [Heyn] Reflected tables for refin, no more per-byte reverse.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-04 [Heyn] New add compute_multi(), batch() frames hashed four at a time in lockstep.
+*                       2022-06-07 [Heyn] udp/tcp sum with 64-bit accumulators ( AVX2 kernel ), new add udp_update/tcp_update ( RFC 1624 ).
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-10 [Heyn] compute_init() points the descriptor at the tables also when they are built ( hacker table cache ).
+*                       2022-06-12 [Heyn] The engine is _hexin_core.h ( slicing-by-8, CLMUL folding, threads, combine, batch ), same for crc8/16/24/32/64/x/canx.
 *
 *********************************************************************************************************
 */
 
+#define HEXIN_CORE_IMPLEMENTATION                                       /* The engine functions, see _hexin_core.h */
 #include "_crc16tables.h"
 
-/* Fixed Issues #8 */
-static unsigned char __hexin_reverse8( unsigned char data )
-{
-    unsigned int  i = 0;
-    unsigned char t = 0;
-    for ( i=0; i<8; i++ ) {
-        t |= ( ( data >> i ) & 0x01 ) << ( 7-i );
-    }
-    return t;
-}
-
-unsigned short hexin_reverse16( unsigned short data )
-{
-    unsigned int   i = 0;
-    unsigned short t = 0;
-    for ( i=0; i<16; i++ ) {
-        t |= ( ( data >> i ) & 0x0001 ) << ( 15-i );
-    }
-    return t;
-}
-
-unsigned int hexin_crc16_init_table_poly_is_high( unsigned short polynomial, unsigned short *table )
-{
-    unsigned int i = 0, j = 0;
-    unsigned short crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = ( unsigned short ) i;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x0001 )   crc = ( crc >> 1 ) ^ polynomial;
-            else                        crc = crc >> 1;
-            c = c >> 1;
-        }
-        table[i] = crc;
-    }
-    return TRUE;
-}
-
-unsigned int hexin_crc16_init_table_poly_is_low( unsigned short polynomial, unsigned short *table )
-{
-    unsigned int i = 0, j = 0;
-    unsigned short crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = ((unsigned short) i) << 8;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ polynomial;
-            else                      crc = crc << 1;
-            c = c << 1;
-        }
-        table[i] = crc;
-    }
-    return TRUE;
-}
-
-unsigned short hexin_crc16_poly_is_high_calc( unsigned short crc16, unsigned char c, const unsigned short *table )
-{
-    unsigned short crc = crc16;
-    unsigned short tmp, short_c;
-
-    short_c = 0x00FF & (unsigned short) c;
-    tmp =  crc       ^ short_c;
-    crc = (crc >> 8) ^ table[ tmp & 0xFF ];
-
-    return crc;
-}
-
-unsigned short hexin_crc16_poly_is_low_calc( unsigned short crc16, unsigned char c, const unsigned short *table )
-{
-    unsigned short crc = crc16;
-    unsigned short tmp, short_c;
-
-    short_c  = 0x00FF & (unsigned short) c;
-    tmp = (crc >> 8) ^ short_c;
-    crc = (crc << 8) ^ table[tmp];
-
-    return crc;
-}
-
 static unsigned short __hexin_crc16_sick( unsigned short crc16, unsigned char c, char prev_byte ) 
 {
     unsigned short crc = crc16;
@@ -120,9 +53,9 @@ static unsigned short __hexin_crc16_sick( unsigned short crc16, unsigned char c,
     return crc;
 }
 
-unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int len, unsigned short crc16 )
+unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, size_t len, unsigned short crc16 )
 {
-    unsigned int   i            = 0;
+    size_t         i            = 0;
 			 char  prev_byte	= 0x00;
 	unsigned short crc		    = crc16;
 
@@ -134,94 +67,15 @@ unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int le
 	return crc;
 }
 
-unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
-{
-    unsigned int sum = 0;
-
-    while ( len > 1 ) {
-        sum  += *( unsigned short * )pSrc;
-        len  -= 2;
-        pSrc += 2;
-    }
- 
-    if ( len ) {
-        sum += *(unsigned char *) pSrc;
-    }
- 
-    while ( sum >> 16 ) {
-        sum = ( sum >> 16 ) + ( sum & 0xFFFF );
-    }
- 
-    return ( unsigned short )( ~sum );
-}
-
-unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
-{
-    unsigned int i = 0;
-    unsigned short sum1 = 0, sum2 = 0;
-
-    for ( i = 0; i < len; i++ ) {
-        sum1 = ( sum1 + pSrc[i] ) % 255;
-        sum2 = ( sum2 + sum1 ) % 255;
-    }
-    return ( sum1 & 0xFF ) | ( sum2 << 8 );
-}
-
-static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param )
-{
-    unsigned int i = 0, j = 0;
-    unsigned short crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = ( ( unsigned short ) i ) << 8;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ param->poly;
-            else                      crc =   crc << 1;
-            c = c << 1;
-        }
-        param->table[i] = crc;
-    }
-
-    return TRUE;
-}
-
-static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned char c, struct _hexin_crc16 *param )
+unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, size_t len, unsigned short crc16 /*reserved*/ )
 {
-    unsigned short crc = crc16;
-    crc = (crc << 8) ^ param->table[ ((crc >> 8 ) ^ (0x00FF & (unsigned short)c)) & 0xFF ];
-    return crc;
+    return ( unsigned short )~hexin_network_sum( pSrc, len, 0 );
 }
 
-unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc16 *param, unsigned short init )
+unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, size_t len, unsigned short crc16 )
 {
-    unsigned int i = 0;
-    unsigned short crc = init;              /* Fixed Issues #4  */
-
-    if ( param->is_initial == FALSE ) {
-        param->is_initial = hexin_crc16_compute_init_table( param );
-    }
-
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) { 
-        crc = hexin_reverse16( init );
-    }
-
-    /* Fixed Issues #8 */
-    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
-        for ( i=0; i<len; i++ ) {
-            crc = hexin_crc16_compute_char( crc, __hexin_reverse8( pSrc[i] ), param );
-        }
-    } else {
-        for ( i=0; i<len; i++ ) {
-            crc = hexin_crc16_compute_char( crc, pSrc[i], param );
-        }
-    }
-
-    /* Fixed Issues #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
-        crc = hexin_reverse16( crc );
-    }
+    unsigned int sums[2] = { crc16 & 0xFF, ( crc16 >> 8 ) & 0xFF };
 
-	return ( crc ^ param->xorout );
+    hexin_fletcher_sum8( pSrc, len, 255, sums );
+    return ( unsigned short )( sums[0] | ( sums[1] << 8 ) );
 }
@@ -0,0 +1,27 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc24models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc24 of _crc24module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc24gentables.h ) and by _crc24module.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly        init        refin   refout  xorout */
+HEXIN_MODEL( crc24_param_ble,              24,    0x0000065B, 0x00555555, TRUE,   TRUE,   0x00000000 )
+HEXIN_MODEL( crc24_param_flexraya,         24,    0x005D6DCB, 0x00FEDCBA, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc24_param_flexrayb,         24,    0x005D6DCB, 0x00ABCDEF, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc24_param_openpgp,          24,    0x00864CFB, 0x00B704CE, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc24_param_lte_a,            24,    0x00864CFB, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc24_param_lte_b,            24,    0x00800063, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc24_param_os9,              24,    0x00800063, 0x00FFFFFF, FALSE,  FALSE,  0x00FFFFFF )
+HEXIN_MODEL( crc24_param_interlaken,       24,    0x00328B63, 0x00FFFFFF, FALSE,  FALSE,  0x00FFFFFF )
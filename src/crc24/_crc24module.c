@@ -13,257 +13,172 @@
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2020-11-18 [Heyn] Fixed (Python2) Parsing arguments has no 'p' type
 *                       2021-06-07 [Heyn] Add hacker24() reinit parameter. reinit=True -> Reinitialize the table
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, batch() hashes frames in lockstep ( compute_multi ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc24models.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 ********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crc24tables.h"
+#include "_crc24gentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc24models.h ), the tables are the ones generated by setup.py ( _crc24gentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc24 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crc24models.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc24 *param;
+} hexin_crc24_models[] = {
+    { "ble",        &crc24_param_ble },
+    { "flexraya",   &crc24_param_flexraya },
+    { "flexrayb",   &crc24_param_flexrayb },
+    { "openpgp",    &crc24_param_openpgp },
+    { "crc24",      &crc24_param_openpgp },
+    { "lte_a",      &crc24_param_lte_a },
+    { "lte_b",      &crc24_param_lte_b },
+    { "os9",        &crc24_param_os9 },
+    { "interlaken", &crc24_param_interlaken },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc24 *param )
+#define                 HEXIN_MODULE_NAME                       crc24
+#define                 HEXIN_MODULE_TYPE                       unsigned int
+#define                 HEXIN_MODULE_BITS                       24
+#define                 HEXIN_MODULE_TITLE                      "CRC24"
+#define                 HEXIN_MODULE_HACKER                     "hacker24"
+#define                 HEXIN_MODULE_HACKER_PARAM               { .is_initial = FALSE,                     \
+                                                                  .width  = HEXIN_CRC24_WIDTH,              \
+                                                                  .poly   = CRC24_POLYNOMIAL_800063,        \
+                                                                  .init   = 0x00FFFFFF,                     \
+                                                                  .refin  = FALSE,                          \
+                                                                  .refout = FALSE,                          \
+                                                                  .xorout = 0x00FFFFFF }
+#include "_hexin_module.h"
+
+static PyObject * _crc24_ble( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
-    }
-
-    param->result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
+    unsigned int result = 0;
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
-
-static PyObject * _crc24_ble( PyObject *self, PyObject *args )
-{
-    static struct _hexin_crc24 crc24_param_ble = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_00065B,
-                                                   .init   = 0x00555555,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00000000,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_ble ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_ble, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_ble.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_flexraya( PyObject *self, PyObject *args )
+static PyObject * _crc24_flexraya( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_flexraya = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00FEDCBA,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexraya ) ) {
-        return NULL;
-    }
-
-    return Py_BuildValue( "I", crc24_param_flexraya.result );
-}
+    unsigned int result = 0;
 
-static PyObject * _crc24_flexrayb( PyObject *self, PyObject *args )
-{
-    static struct _hexin_crc24 crc24_param_flexrayb = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00ABCDEF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexrayb ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_flexraya, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_flexrayb.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_openpgp( PyObject *self, PyObject *args )
+static PyObject * _crc24_flexrayb( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_openpgp = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC24_WIDTH,
-                                                       .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                       .init   = 0x00B704CE,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x00000000,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_openpgp ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_flexrayb, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_openpgp.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_lte_a( PyObject *self, PyObject *args )
+static PyObject * _crc24_openpgp( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_lte_a = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_a ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_openpgp, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_a.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_lte_b( PyObject *self, PyObject *args )
+static PyObject * _crc24_lte_a( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_lte_b = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_800063,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_b ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_lte_a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_b.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_os9( PyObject *self, PyObject *args )
+static PyObject * _crc24_lte_b( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_os9 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_800063,
-                                                   .init   = 0x00FFFFFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00FFFFFF,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_os9 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_lte_b, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_os9.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_interlaken( PyObject *self, PyObject *args )
+static PyObject * _crc24_os9( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc24 crc24_param_interlaken = { .is_initial=FALSE,
-                                                          .width  = HEXIN_CRC24_WIDTH,
-                                                          .poly   = CRC24_POLYNOMIAL_328B63,
-                                                          .init   = 0x00FFFFFF,
-                                                          .refin  = FALSE,
-                                                          .refout = FALSE,
-                                                          .xorout = 0x00FFFFFF,
-                                                          .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_interlaken ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_os9, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_interlaken.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc24_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc24_interlaken( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc24 crc24_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC24_WIDTH,
-                                                      .poly   = CRC24_POLYNOMIAL_800063,
-                                                      .init   = 0x00FFFFFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x00FFFFFF,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    unsigned int result = 0;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIppp", kwlist, &data,
-                                                                       &crc24_param_hacker.poly,
-                                                                       &crc24_param_hacker.init,
-                                                                       &crc24_param_hacker.xorout,
-                                                                       &crc24_param_hacker.refin,
-                                                                       &crc24_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;        
-    }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIIII", kwlist, &data,
-                                                                       &crc24_param_hacker.poly,
-                                                                       &crc24_param_hacker.init,
-                                                                       &crc24_param_hacker.xorout,
-                                                                       &crc24_param_hacker.refin,
-                                                                       &crc24_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;  
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc24_param_interlaken, &result ) ) {
+        return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
-
-    crc24_param_hacker.is_initial = ( reinit == FALSE ) ? crc24_param_hacker.is_initial : FALSE;
-    crc24_param_hacker.result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc24_param_hacker, crc24_param_hacker.init );
-    
-    if ( data.obj )
-       PyBuffer_Release( &data );
 
-    return Py_BuildValue( "I", crc24_param_hacker.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 /* method table */
 static PyMethodDef _crc24Methods[] = {
-    { "ble",         (PyCFunction)_crc24_ble,        METH_VARARGS,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexraya",    (PyCFunction)_crc24_flexraya,   METH_VARARGS,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   METH_VARARGS,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "openpgp",     (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "crc24",       (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "lte_a",       (PyCFunction)_crc24_lte_a,      METH_VARARGS,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "lte_b",       (PyCFunction)_crc24_lte_b,      METH_VARARGS,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "os9",         (PyCFunction)_crc24_os9,        METH_VARARGS,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "interlaken",  (PyCFunction)_crc24_interlaken, METH_VARARGS,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "hacker24",    (PyCFunction)_crc24_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC24\n"
+    { "ble",         (PyCFunction)_crc24_ble,        HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexraya",    (PyCFunction)_crc24_flexraya,   HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "openpgp",     (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "crc24",       (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "lte_a",       (PyCFunction)_crc24_lte_a,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "lte_b",       (PyCFunction)_crc24_lte_b,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "os9",         (PyCFunction)_crc24_os9,        HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "interlaken",  (PyCFunction)_crc24_interlaken, HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "hacker24",    (PyCFunction)_crc24_hacker,     HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC24\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x00800063\n"
                                                                                  "@init   : default=0x00FFFFFF\n"
@@ -271,6 +186,7 @@ static PyMethodDef _crc24Methods[] = {
                                                                                  "@refin  : default=False\n"
                                                                                  "@refout : default=False\n"
                                                                                  "@reinit : default=False" },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -307,6 +223,18 @@ PyInit__crc24( void )
 {
     PyObject *m;
 
+    if ( hexin_crc24_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc24_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crc24module );
     if ( m == NULL ) {
         return NULL;
@@ -324,6 +252,14 @@ PyInit__crc24( void )
 PyMODINIT_FUNC
 init_crc24( void )
 {
+    if ( hexin_crc24_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc24_compute() may run without the GIL. */
+    hexin_cpu_features();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     ( void ) Py_InitModule3( "_crc24", _crc24Methods, _crc24_doc );
 }
 
@@ -12,6 +12,14 @@
 *                       2020-04-27 [Heyn] Optimized code.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -19,6 +27,8 @@
 #ifndef __CRC24_TABLES_H__
 #define __CRC24_TABLES_H__
 
+#include <stddef.h>
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -37,7 +47,7 @@
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
 
 #define                 CRC24_POLYNOMIAL_00065B                 0x00065B
 #define                 CRC24_POLYNOMIAL_5D6DCB                 0x5D6DCB
@@ -45,20 +55,10 @@
 #define                 CRC24_POLYNOMIAL_800063                 0x800063
 #define                 CRC24_POLYNOMIAL_328B63                 0x328B63
 
-
-struct _hexin_crc24 {
-    unsigned int  is_initial;
-    unsigned int  is_gradual;
-    unsigned int  width;
-    unsigned int  poly;
-    unsigned int  init;
-    unsigned int  refin;
-    unsigned int  refout;
-    unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
-};
-
-unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc24 *param, unsigned int init );
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         crc24
+#define                 HEXIN_CORE_TYPE                         unsigned int
+#define                 HEXIN_CORE_BITS                         32
+#include "_hexin_core.h"
 
 #endif //__CRC24_TABLES_H__
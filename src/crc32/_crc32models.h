@@ -0,0 +1,32 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc32models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc32 of _crc32module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc32gentables.h ) and by _crc32module.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly        init        refin   refout  xorout */
+HEXIN_MODEL( crc32_param_mpeg2,            32,    0x04C11DB7, 0xFFFFFFFF, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc32_param_crc32,            32,    0x04C11DB7, 0xFFFFFFFF, TRUE,   TRUE,   0xFFFFFFFF )
+HEXIN_MODEL( crc32_param_posix,            32,    0x04C11DB7, 0x00000000, FALSE,  FALSE,  0xFFFFFFFF )
+HEXIN_MODEL( crc32_param_bzip2,            32,    0x04C11DB7, 0xFFFFFFFF, FALSE,  FALSE,  0xFFFFFFFF )
+HEXIN_MODEL( crc32_param_jamcrc,           32,    0x04C11DB7, 0xFFFFFFFF, TRUE,   TRUE,   0x00000000 )
+HEXIN_MODEL( crc32_param_autosar,          32,    0xF4ACFB13, 0xFFFFFFFF, TRUE,   TRUE,   0xFFFFFFFF )
+HEXIN_MODEL( crc32_iscsi,                  32,    0x1EDC6F41, 0xFFFFFFFF, TRUE,   TRUE,   0xFFFFFFFF )
+HEXIN_MODEL( crc32_base91,                 32,    0xA833982B, 0xFFFFFFFF, TRUE,   TRUE,   0xFFFFFFFF )
+HEXIN_MODEL( crc32_aixm,                   32,    0x814141AB, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc32_param_xfer,             32,    0x000000AF, 0x00000000, FALSE,  FALSE,  0x00000000 )
+HEXIN_MODEL( crc30_cdma_param,             30,    0x2030B9C7, 0x3FFFFFFF, FALSE,  FALSE,  0x3FFFFFFF )
+HEXIN_MODEL( crc31_philips_param,          31,    0x04C11DB7, 0x7FFFFFFF, FALSE,  FALSE,  0x7FFFFFFF )
+HEXIN_MODEL( crc32_stm32_param,            32,    0x04C11DB7, 0xFFFFFFFF, FALSE,  FALSE,  0x00000000 )
@@ -19,76 +19,119 @@
 *                      2020-08-04 [Heyn] Fixed Issues #4.
 *                      2020-11-18 [Heyn] Fixed (Python2) Parsing arguments has no 'p' type
 *                      2021-06-07 [Heyn] Add hacker32() reinit parameter. reinit=True -> Reinitialize the table
+*                      2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                      2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                      2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                      2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                      2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                      2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                      2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                      2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                      2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                      2022-06-04 [Heyn] batch() uses the multi-buffer kernel hexin_xxx_compute_multi().
+*                      2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                      2022-06-06 [Heyn] adler32() is reduced once per NMAX bytes ( SSSE3/AVX2 kernels ) and goes on from its value argument.
+*                      2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                      2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                      2022-06-12 [Heyn] hacker32() and table() use hexin_crc32_reverse() of the engine.
+*                      2022-06-13 [Heyn] New add _kernel() and _cpu_features() ( libscrc.kernel_for / cpu_features ).
+*                      2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc32models.h, setup.py build_ext generates the tables.
+*                      2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
 *
 * Web : https://en.wikipedia.org/wiki/Polynomial_representations_of_cyclic_redundancy_checks
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 ********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crc32tables.h"
+#include "_crc32gentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc32models.h ), the tables are the ones generated by setup.py ( _crc32gentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc32 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crc32models.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc32 *param;
+} hexin_crc32_models[] = {
+    { "mpeg2",      &crc32_param_mpeg2 },
+    { "fsc",        &crc32_param_mpeg2 },
+    { "crc32",      &crc32_param_crc32 },
+    { "iso_hdlc32", &crc32_param_crc32 },
+    { "xz32",       &crc32_param_crc32 },
+    { "pkzip",      &crc32_param_crc32 },
+    { "adccp",      &crc32_param_crc32 },
+    { "v_42",       &crc32_param_crc32 },
+    { "posix",      &crc32_param_posix },
+    { "cksum",      &crc32_param_posix },
+    { "bzip2",      &crc32_param_bzip2 },
+    { "aal5",       &crc32_param_bzip2 },
+    { "jamcrc",     &crc32_param_jamcrc },
+    { "autosar",    &crc32_param_autosar },
+    { "crc32_c",    &crc32_iscsi },
+    { "iscsi",      &crc32_iscsi },
+    { "base91_c",   &crc32_iscsi },
+    { "crc32_d",    &crc32_base91 },
+    { "base91_d",   &crc32_base91 },
+    { "crc32_q",    &crc32_aixm },
+    { "aixm",       &crc32_aixm },
+    { "xfer",       &crc32_param_xfer },
+    { "cdma",       &crc30_cdma_param },
+    { "philips",    &crc31_philips_param },
+    { "ecmxf",      &crc32_param_crc32 },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#define                 HEXIN_MODULE_NAME                       crc32
+#define                 HEXIN_MODULE_TYPE                       unsigned int
+#define                 HEXIN_MODULE_BITS                       32
+#define                 HEXIN_MODULE_TITLE                      "CRC32"
+#define                 HEXIN_MODULE_HACKER                     "hacker32"
+#define                 HEXIN_MODULE_HACKER_PARAM               { .is_initial = FALSE,                     \
+                                                                  .width  = HEXIN_CRC32_WIDTH,              \
+                                                                  .poly   = CRC32_POLYNOMIAL_04C11DB7,      \
+                                                                  .init   = 0xFFFFFFFFL,                    \
+                                                                  .refin  = TRUE,                           \
+                                                                  .refout = TRUE,                           \
+                                                                  .xorout = 0xFFFFFFFFL }
+#include "_hexin_module.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS,
                                              unsigned int init,
                                              unsigned int (*function)( const unsigned char *,
-                                                                       unsigned int,
+                                                                       size_t,
                                                                        unsigned int ),
                                              unsigned int *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned long long value = init;
+    PyObject *values[2];
+    static const char* kwlist[]={ "data", "init", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
-
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc32 *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;          /* Fixed Issues #4  */
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_NOKW_PASS, NULL, kwlist, 1, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[1], &value ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned int )value;
 
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
     }
-    
-    param->result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -96,40 +139,26 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc32_mpeg_2( PyObject *self, PyObject *args )
+static PyObject * _crc32_mpeg_2( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_mpeg2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000L,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_mpeg2 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_mpeg2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_mpeg2.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_crc32( PyObject *self, PyObject *args )
+static PyObject * _crc32_crc32( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_crc32 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_crc32 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_crc32, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_crc32.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 static PyObject * _crc32_table( PyObject *self, PyObject *args )
@@ -155,7 +184,7 @@ static PyObject * _crc32_table( PyObject *self, PyObject *args )
     if ( FALSE == ref ) {
         hexin_crc32_init_table_poly_is_low ( poly << (HEXIN_CRC32_WIDTH-bits), table );
     } else {
-        poly = ( hexin_reverse32( poly ) >> ( HEXIN_CRC32_WIDTH - bits ) );
+        poly = ( hexin_crc32_reverse( poly ) >> ( HEXIN_CRC32_WIDTH - bits ) );
         hexin_crc32_init_table_poly_is_high( poly, table );
     }
 
@@ -166,278 +195,147 @@ static PyObject * _crc32_table( PyObject *self, PyObject *args )
     return plist;
 }
 
-static PyObject * _crc32_hacker( PyObject *self, PyObject *args, PyObject* kws )
-{
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc32 crc32_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC32_WIDTH,
-                                                      .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                      .init   = 0xFFFFFFFFL,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0xFFFFFFFFL,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIppp", kwlist, &data,
-                                                                       &crc32_param_hacker.poly,
-                                                                       &crc32_param_hacker.init,
-                                                                       &crc32_param_hacker.xorout,
-                                                                       &crc32_param_hacker.refin,
-                                                                       &crc32_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;        
-    }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIIII", kwlist, &data,
-                                                                       &crc32_param_hacker.poly,
-                                                                       &crc32_param_hacker.init,
-                                                                       &crc32_param_hacker.xorout,
-                                                                       &crc32_param_hacker.refin,
-                                                                       &crc32_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;  
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    crc32_param_hacker.is_initial = ( reinit == FALSE ) ? crc32_param_hacker.is_initial : FALSE;
-    crc32_param_hacker.result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc32_param_hacker, crc32_param_hacker.init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return Py_BuildValue( "I", crc32_param_hacker.result );
-}
-
-static PyObject * _crc32_adler32( PyObject *self, PyObject *args )
+static PyObject * _crc32_adler32( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
-    unsigned int result   = 0x00000000L;
-    unsigned int reserved = 0x00000000L;
+    unsigned int result = 0x00000000L;
+    unsigned int init   = 0x00000001L;         /* Same as zlib.adler32( data, value=1 ) */
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_adler, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc32_adler, ( unsigned int * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_fletcher32( PyObject *self, PyObject *args )
+static PyObject * _crc32_fletcher32( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
-    unsigned int result   = 0x00000000L;
-    unsigned int reserved = 0x00000000L;
+    unsigned int result = 0x00000000L;
+    unsigned int init   = 0xFFFFFFFFL;         /* Both sums start at 0xFFFF */
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_fletcher, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc32_fletcher, ( unsigned int * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_posix( PyObject *self, PyObject *args )
+static PyObject * _crc32_posix( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_posix = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0x00000000L,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_posix ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_posix, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_posix.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 /*
 * Alias: CRC-32/AAL5, CRC-32/DECT-B, B-CRC-32
 */
-static PyObject * _crc32_bzip2( PyObject *self, PyObject *args )
+static PyObject * _crc32_bzip2( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_bzip2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_bzip2 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_bzip2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_bzip2.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_jamcrc( PyObject *self, PyObject *args )
+static PyObject * _crc32_jamcrc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_jamcrc = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC32_WIDTH,
-                                                      .poly   = 0x04C11DB7L,
-                                                      .init   = 0xFFFFFFFFL,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x00000000L,
-                                                      .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_jamcrc ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_jamcrc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_jamcrc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_autosar( PyObject *self, PyObject *args )
+static PyObject * _crc32_autosar( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_autosar = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC32_WIDTH,
-                                                       .poly   = 0xF4ACFB13L,
-                                                       .init   = 0xFFFFFFFFL,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0xFFFFFFFFL,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_autosar ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_autosar, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_autosar.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_crc32_c( PyObject *self, PyObject *args )
+static PyObject * _crc32_crc32_c( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_iscsi = { .is_initial=FALSE,
-                                               .width  = HEXIN_CRC32_WIDTH,
-                                               .poly   = 0x1EDC6F41L,
-                                               .init   = 0xFFFFFFFFL,
-                                               .refin  = TRUE,
-                                               .refout = TRUE,
-                                               .xorout = 0xFFFFFFFFL,
-                                               .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_iscsi ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_iscsi, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_iscsi.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_crc32_d( PyObject *self, PyObject *args )
+static PyObject * _crc32_crc32_d( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_base91 = { .is_initial=FALSE,
-                                                .width  = HEXIN_CRC32_WIDTH,
-                                                .poly   = 0xA833982BL,
-                                                .init   = 0xFFFFFFFFL,
-                                                .refin  = TRUE,
-                                                .refout = TRUE,
-                                                .xorout = 0xFFFFFFFFL,
-                                                .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_base91 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_base91, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_base91.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_crc32_q( PyObject *self, PyObject *args )
+static PyObject * _crc32_crc32_q( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_aixm = { .is_initial=FALSE,
-                                              .width  = HEXIN_CRC32_WIDTH,
-                                              .poly   = 0x814141ABL,
-                                              .init   = 0,
-                                              .refin  = FALSE,
-                                              .refout = FALSE,
-                                              .xorout = 0,
-                                              .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_aixm ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_aixm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_aixm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc32_xfer( PyObject *self, PyObject *args )
+static PyObject * _crc32_xfer( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc32_param_xfer = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC32_WIDTH,
-                                                    .poly   = 0x000000AFL,
-                                                    .init   = 0x00000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x00000000L,
-                                                    .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_xfer ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc32_param_xfer, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_xfer.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc30_cdma( PyObject *self, PyObject *args )
+static PyObject * _crc30_cdma( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc30_cdma_param = { .is_initial=FALSE,
-                                                    .width  = 30,
-                                                    .poly   = CRC30_POLYNOMIAL_2030B9C7,
-                                                    .init   = 0x3FFFFFFFL,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FFFFFFFL,
-                                                    .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc30_cdma_param ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc30_cdma_param, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc30_cdma_param.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc31_philips( PyObject *self, PyObject *args )
+static PyObject * _crc31_philips( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc32 crc31_philips_param = { .is_initial=FALSE,
-                                                       .width  = 31,
-                                                       .poly   = CRC31_POLYNOMIAL_04C11DB7,
-                                                       .init   = 0x7FFFFFFFL,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x7FFFFFFFL,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc31_philips_param ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc31_philips_param, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc31_philips_param.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 static PyObject * _crc32_stm32( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc32 crc32_stm32_param = {   .is_initial=FALSE,
-                                                       .width  = 32,
-                                                       .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                       .init   = 0xFFFFFFFFL,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x00000000L,
-                                                       .result = 0 };
-
     Py_buffer data = { NULL, NULL };
+    unsigned int result = 0;
     unsigned int init = crc32_stm32_param.init;          /* Fixed Issues #4  */
 
 #if PY_MAJOR_VERSION >= 3
@@ -457,32 +355,59 @@ static PyObject * _crc32_stm32( PyObject *self, PyObject *args )
 #endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    crc32_stm32_param.is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( crc32_stm32_param.is_gradual == 2 ) {
+    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( PyTuple_Size( args ) ) ) {
         init = ( init ^ crc32_stm32_param.xorout );
     }
-    
-    crc32_stm32_param.result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (unsigned int)data.len, &crc32_stm32_param, init );
+
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (size_t)data.len, &crc32_stm32_param, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (size_t)data.len, &crc32_stm32_param, init );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
 
-    return Py_BuildValue( "I", crc32_stm32_param.result );
+    return Py_BuildValue( "I", result );
+}
+
+/* The CPU features the kernels use ( CPUID, capped by LIBSCRC_KERNEL ), use libscrc.cpu_features() */
+static PyObject * _crc32_cpu_features( PyObject *self, PyObject *unused )
+{
+    unsigned int i = 0, features = hexin_cpu_features();
+    PyObject *result = PyDict_New(), *value = NULL;
+
+    if ( result == NULL ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_cpu_names[i].name != NULL; i++ ) {
+        value = PyBool_FromLong( ( features & hexin_cpu_names[i].value ) != 0 );
+        if ( ( value == NULL ) || ( PyDict_SetItemString( result, hexin_cpu_names[i].name, value ) < 0 ) ) {
+            Py_XDECREF( value );
+            Py_DECREF( result );
+            return NULL;
+        }
+        Py_DECREF( value );
+    }
+    return result;
 }
 
 /* method table */
 static PyMethodDef _crc32Methods[] = {
-    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "fsc",         (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "crc32",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "xz32",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "pkzip",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "adccp",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "v_42",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "fsc",         (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "crc32",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "xz32",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "pkzip",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "adccp",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "v_42",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
     { "table32",     (PyCFunction)_crc32_table,      METH_VARARGS,   "Print CRC32 table to list. libscrc.table32( polynomial, False, 32 )" },
-    { "hacker32",    (PyCFunction)_crc32_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC32\n"
+    { "hacker32",    (PyCFunction)_crc32_hacker,     HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC32\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x04C11DB7\n"
                                                                                  "@init   : default=0xFFFFFFFF\n"
@@ -490,26 +415,28 @@ static PyMethodDef _crc32Methods[] = {
                                                                                  "@refin  : default=True\n"
                                                                                  "@refout : default=True\n"
                                                                                  "@reinit : default=False" },
-    { "adler32",    (PyCFunction)_crc32_adler32,     METH_VARARGS,   "Calculate adler32 (MOD=65521)" },
-    { "fletcher32", (PyCFunction)_crc32_fletcher32,  METH_VARARGS,   "Calculate fletcher32" },
-    { "posix",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "cksum",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "bzip2",      (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "aal5",       (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      METH_VARARGS,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "autosar",    (PyCFunction)_crc32_autosar,     METH_VARARGS,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iscsi",      (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_c",   (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_d",   (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "aixm",       (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "xfer",       (PyCFunction)_crc32_xfer,        METH_VARARGS,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "cdma",       (PyCFunction)_crc30_cdma,        METH_VARARGS,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
-    { "philips",    (PyCFunction)_crc31_philips,     METH_VARARGS,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
+    { "adler32",    (PyCFunction)_crc32_adler32,     HEXIN_METH_FASTCALL,   "Calculate adler32 (MOD=65521). libscrc.adler32( data, value=1 ), value goes on from a previous result" },
+    { "fletcher32", (PyCFunction)_crc32_fletcher32,  HEXIN_METH_FASTCALL,   "Calculate fletcher32. libscrc.fletcher32( data, value=0xFFFFFFFF ), value goes on from a previous result ( of an even length )" },
+    { "posix",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "cksum",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "bzip2",      (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "aal5",       (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "autosar",    (PyCFunction)_crc32_autosar,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iscsi",      (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_c",   (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_d",   (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "aixm",       (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "xfer",       (PyCFunction)_crc32_xfer,        HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "cdma",       (PyCFunction)_crc30_cdma,        HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
+    { "philips",    (PyCFunction)_crc31_philips,     HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
     { "stm32",      (PyCFunction)_crc32_stm32,       METH_VARARGS,   "Calculate STM32 of CRC32 (Hardware calculate CRC32)"},
-    { "ecmxf",      (PyCFunction)_crc32_crc32,       METH_VARARGS,   "Calculate ECMXF of CRC32" },
+    { "ecmxf",      (PyCFunction)_crc32_crc32,       HEXIN_METH_FASTCALL_KEYWORDS,   "Calculate ECMXF of CRC32" },
+    HEXIN_MODULE_METHODS,
+    { "_cpu_features", (PyCFunction)_crc32_cpu_features, METH_NOARGS, "The CPU features the kernels use, use libscrc.cpu_features()" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -526,7 +453,7 @@ PyDoc_STRVAR( _crc32_doc,
 "libscrc.v_42       -> Calculate V-42 [Poly=0x04C11DB7L, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]\n"
 "libscrc.table32    -> Print CRC32 table to list. libscrc.table32( polynomial, False, 32 )\n"
 "libscrc.hacker32   -> Free calculation CRC32 @reinit reinitialize the crc32 tables\n"
-"libscrc.adler32    -> Calculate adler32 (MOD=65521)\n"
+"libscrc.adler32    -> Calculate adler32 (MOD=65521), adler32( data, value ) goes on from value\n"
 "libscrc.fletcher32 -> Calculate fletcher32\n"
 "libscrc.posix      -> Calculate CRC (POSIX) [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=False Refout=False]\n"
 "libscrc.cksum      -> Calculate CRC (CKSUM) [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=False Refout=False]\n"
@@ -563,6 +490,19 @@ PyInit__crc32( void )
 {
     PyObject *m;
 
+    if ( hexin_crc32_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import, hexin_crc32_compute() may run without the GIL. */
+    hexin_clmul_is_supported();
+    hexin_crc32c_hw_is_supported();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crc32module );
     if ( m == NULL ) {
         return NULL;
@@ -580,6 +520,15 @@ PyInit__crc32( void )
 PyMODINIT_FUNC
 init_crc32( void )
 {
+    if ( hexin_crc32_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import, hexin_crc32_compute() may run without the GIL. */
+    hexin_clmul_is_supported();
+    hexin_crc32c_hw_is_supported();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     ( void ) Py_InitModule3( "_crc32", _crc32Methods, _crc32_doc );
 }
 
@@ -12,6 +12,20 @@
 *                       2020-04-26 [Heyn] Optimized Code.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
+*                       2022-05-09 [Heyn] New add slicing-by-8 tables.
+*                       2022-05-16 [Heyn] New add PCLMULQDQ folding constants.
+*                       2022-05-18 [Heyn] New add SSE4.2 CRC32C.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-04 [Heyn] New add compute_multi(), batch() frames hashed four at a time in lockstep.
+*                       2022-06-06 [Heyn] adler32() is reduced once per NMAX bytes ( SSSE3/AVX2 kernels ) and goes on from its value argument.
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -19,6 +33,12 @@
 #ifndef __CRC32_TABLES_H__
 #define __CRC32_TABLES_H__
 
+#include <stddef.h>
+#include "_hexin_clmul.h"
+#include "_hexin_crc32c.h"
+#include "_hexin_adler32.h"
+#include "_hexin_fletcher.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -39,35 +59,23 @@
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
+#define                 HEXIN_CRC32C_IS_TRUE(x)                 ( ( x->width == HEXIN_CRC32_WIDTH ) && ( x->poly == HEXIN_CRC32C_POLYNOMIAL ) )
 
 #define                 CRC30_POLYNOMIAL_2030B9C7               0x2030B9C7L
 #define                 CRC31_POLYNOMIAL_04C11DB7               0x04C11DB7L
 #define		            CRC32_POLYNOMIAL_04C11DB7		        0x04C11DB7L
 
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         crc32
+#define                 HEXIN_CORE_TYPE                         unsigned int
+#define                 HEXIN_CORE_BITS                         32
+#define                 HEXIN_CORE_CRC32C                       /* SSE4.2 crc32 instruction for the CRC32C models */
+#include "_hexin_core.h"
 
-struct _hexin_crc32 {
-    unsigned int  is_initial;
-    unsigned int  is_gradual;
-    unsigned int  width;
-    unsigned int  poly;
-    unsigned int  init;
-    unsigned int  refin;
-    unsigned int  refout;
-    unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
-};
-
-
-unsigned int hexin_reverse32( unsigned int data );
-
-unsigned int hexin_crc32_init_table_poly_is_high( unsigned int polynomial, unsigned int *table );
-unsigned int hexin_crc32_init_table_poly_is_low(  unsigned int polynomial, unsigned int *table );
+unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, size_t len, unsigned int adler );
+unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, size_t len, unsigned int crc32 );
 
-unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
-unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
-unsigned int hexin_crc32_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init );
-unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init );
+unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init );
 
 #endif //__CRC32_TABLES_H__
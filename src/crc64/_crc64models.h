@@ -0,0 +1,24 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc64models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc64 of _crc64module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc64gentables.h ) and by _crc64module.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly                   init                   refin   refout  xorout */
+HEXIN_MODEL( crc64_param_goiso,            64,    0x000000000000001BULL, 0xFFFFFFFFFFFFFFFFULL, TRUE,   TRUE,   0xFFFFFFFFFFFFFFFFULL )
+HEXIN_MODEL( crc64_param_ecma,             64,    0x42F0E1EBA9EA3693ULL, 0x0000000000000000ULL, FALSE,  FALSE,  0x0000000000000000ULL )
+HEXIN_MODEL( crc64_param_we,               64,    0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, FALSE,  FALSE,  0xFFFFFFFFFFFFFFFFULL )
+HEXIN_MODEL( crc64_param_xz,               64,    0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, TRUE,   TRUE,   0xFFFFFFFFFFFFFFFFULL )
+HEXIN_MODEL( crc64_param_gsm,              40,    0x0000000004820009ULL, 0x0000000000000000ULL, FALSE,  FALSE,  0x000000FFFFFFFFFFULL )
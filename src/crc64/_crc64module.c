@@ -18,191 +18,121 @@
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2020-11-18 [Heyn] Fixed (Python2) Parsing arguments has no 'p' type
 *                       2021-06-07 [Heyn] Add hacker64() reinit parameter. reinit=True -> Reinitialize the table
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, batch() hashes frames in lockstep ( compute_multi ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc64models.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 *********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crc64tables.h"
+#include "_crc64gentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc64models.h ), the tables are the ones generated by setup.py ( _crc64gentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc64 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crc64models.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc64 *param;
+} hexin_crc64_models[] = {
+    { "iso",     &crc64_param_goiso },
+    { "ecma182", &crc64_param_ecma },
+    { "we",      &crc64_param_we },
+    { "xz64",    &crc64_param_xz },
+    { "gsm40",   &crc64_param_gsm },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc64 *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned long long init = param->init;
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|K", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|K", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
-    }
-
-    param->result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
-
-static PyObject * _crc64_iso( PyObject *self, PyObject *args )
+#define                 HEXIN_MODULE_NAME                       crc64
+#define                 HEXIN_MODULE_TYPE                       unsigned long long
+#define                 HEXIN_MODULE_BITS                       64
+#define                 HEXIN_MODULE_TITLE                      "CRC64"
+#define                 HEXIN_MODULE_HACKER                     "hacker64"
+#define                 HEXIN_MODULE_HACKER_PARAM               { .is_initial = FALSE,                     \
+                                                                  .width  = HEXIN_CRC64_WIDTH,              \
+                                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,       \
+                                                                  .init   = 0x0000000000000000L,            \
+                                                                  .refin  = FALSE,                          \
+                                                                  .refout = FALSE,                          \
+                                                                  .xorout = 0x0000000000000000L }
+#include "_hexin_module.h"
+
+static PyObject * _crc64_iso( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_goiso = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC64_WIDTH,
-                                                     .poly   = 0x000000000000001BL,
-                                                     .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                     .result = 0 };
-#else
-    static struct _hexin_crc64 crc64_param_goiso = { FALSE,
-                                                     HEXIN_CRC64_WIDTH,
-                                                     0x000000000000001BL,
-                                                     0xFFFFFFFFFFFFFFFFL,
-                                                     TRUE,
-                                                     TRUE,
-                                                     0xFFFFFFFFFFFFFFFFL,
-                                                     0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned long long result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_goiso ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc64_param_goiso, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_goiso.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_ecma182( PyObject *self, PyObject *args )
+static PyObject * _crc64_ecma182( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_ecma = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC64_WIDTH,
-                                                    .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                    .init   = 0x0000000000000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x0000000000000000L,
-                                                    .result = 0 };
-#else
-    static struct _hexin_crc64 crc64_param_ecma = { FALSE,
-                                                    HEXIN_CRC64_WIDTH,
-                                                    CRC64_POLYNOMIAL_ECMA182,
-                                                    0,
-                                                    FALSE,
-                                                    FALSE,
-                                                    0,
-                                                    0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned long long result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_ecma ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc64_param_ecma, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_ecma.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_we( PyObject *self, PyObject *args )
+static PyObject * _crc64_we( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_we = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
-#else
-    static struct _hexin_crc64 crc64_param_we = { FALSE,
-                                                  HEXIN_CRC64_WIDTH,
-                                                  CRC64_POLYNOMIAL_ECMA182,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  FALSE,
-                                                  FALSE,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned long long result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_we ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc64_param_we, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_we.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_xz( PyObject *self, PyObject *args )
+static PyObject * _crc64_xz( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_xz = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
-#else
-    static struct _hexin_crc64 crc64_param_xz = { FALSE,
-                                                  HEXIN_CRC64_WIDTH,
-                                                  CRC64_POLYNOMIAL_ECMA182,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  TRUE,
-                                                  TRUE,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned long long result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_xz ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc64_param_xz, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_xz.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_gsm40( PyObject *self, PyObject *args )
+static PyObject * _crc64_gsm40( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-#if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_gsm = { .is_initial=FALSE,
-                                                   .width  = 40,
-                                                   .poly   = 0x0004820009,
-                                                   .init   = 0x0000000000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFFFFFFFFFFL,
-                                                   .result = 0 };
-#else
-    static struct _hexin_crc64 crc64_param_gsm = { FALSE,
-                                                   40,
-                                                   0x0004820009,
-                                                   0x0000000000,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0xFFFFFFFFFFL,
-                                                   0 };
-#endif /* PY_MAJOR_VERSION */
+    unsigned long long result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_gsm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc64_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_gsm.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
 static PyObject * _crc64_table( PyObject *self, PyObject *args )
@@ -224,7 +154,7 @@ static PyObject * _crc64_table( PyObject *self, PyObject *args )
     if ( FALSE == ref ) {
         hexin_crc64_init_table_poly_is_low ( poly, table );
     } else {
-        hexin_crc64_init_table_poly_is_high( hexin_reverse64( poly ), table );
+        hexin_crc64_init_table_poly_is_high( hexin_crc64_reverse( poly ), table );
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
@@ -234,74 +164,21 @@ static PyObject * _crc64_table( PyObject *self, PyObject *args )
     return plist;
 }
 
-static PyObject * _crc64_hacker( PyObject *self, PyObject *args, PyObject* kws )
-{
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-
-    static struct _hexin_crc64 crc64_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC64_WIDTH,
-                                                      .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                      .init   = 0x0000000000000000L,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000000000000000L,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|KKKppp", kwlist, &data,
-                                                                       &crc64_param_hacker.poly,
-                                                                       &crc64_param_hacker.init,
-                                                                       &crc64_param_hacker.xorout,
-                                                                       &crc64_param_hacker.refin,
-                                                                       &crc64_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL; 
-    }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|KKKIII", kwlist, &data,
-                                                                       &crc64_param_hacker.poly,
-                                                                       &crc64_param_hacker.init,
-                                                                       &crc64_param_hacker.xorout,
-                                                                       &crc64_param_hacker.refin,
-                                                                       &crc64_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL; 
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    crc64_param_hacker.is_initial = ( reinit == FALSE ) ? crc64_param_hacker.is_initial : FALSE;
-    crc64_param_hacker.result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc64_param_hacker, crc64_param_hacker.init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return Py_BuildValue( "K", crc64_param_hacker.result );
-}
-
 /* method table */
 static PyMethodDef _crc64Methods[] = {
-    { "iso",         (PyCFunction)_crc64_iso,     METH_VARARGS, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "ecma182",     (PyCFunction)_crc64_ecma182, METH_VARARGS, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
-    { "we",          (PyCFunction)_crc64_we,      METH_VARARGS, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "xz64",        (PyCFunction)_crc64_xz,      METH_VARARGS, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "gsm40",       (PyCFunction)_crc64_gsm40,   METH_VARARGS, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
+    { "iso",         (PyCFunction)_crc64_iso,     HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "ecma182",     (PyCFunction)_crc64_ecma182, HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
+    { "we",          (PyCFunction)_crc64_we,      HEXIN_METH_FASTCALL_KEYWORDS, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "xz64",        (PyCFunction)_crc64_xz,      HEXIN_METH_FASTCALL_KEYWORDS, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "gsm40",       (PyCFunction)_crc64_gsm40,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
     { "table64",     (PyCFunction)_crc64_table,   METH_VARARGS, "Print CRC64 table to list. libscrc.table64( polynomial )" },
-    { "hacker64",    (PyCFunction)_crc64_hacker,  METH_KEYWORDS|METH_VARARGS, "User calculation CRC64\n"
+    { "hacker64",    (PyCFunction)_crc64_hacker,  HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC64\n"
                                                                               "@data   : bytes\n"
                                                                               "@poly   : default=0x42F0E1EBA9EA3693\n"
                                                                               "@init   : default=0x0000000000000000\n"
                                                                               "@xorout : default=0x0000000000000000\n"
                                                                               "@ref    : default=False" },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -336,6 +213,18 @@ PyInit__crc64( void )
 {
     PyObject *m;
 
+    if ( hexin_crc64_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import, hexin_crc64_compute() may run without the GIL. */
+    hexin_clmul_is_supported();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crc64module );
     if ( m == NULL ) {
         return NULL;
@@ -353,6 +242,14 @@ PyInit__crc64( void )
 PyMODINIT_FUNC
 init_crc64( void )
 {
+    if ( hexin_crc64_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import, hexin_crc64_compute() may run without the GIL. */
+    hexin_clmul_is_supported();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     (void) Py_InitModule3( "_crc64", _crc64Methods, _crc64_doc );
 }
 
@@ -12,6 +12,15 @@
 *                       2020-04-23 [Heyn] New add we() and xz() functions.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
+*                       2022-05-20 [Heyn] New add PCLMULQDQ folding constants.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -19,6 +28,9 @@
 #ifndef __CRC64_TABLES_H__
 #define __CRC64_TABLES_H__
 
+#include <stddef.h>
+#include "_hexin_clmul.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -37,30 +49,14 @@
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
 
 #define		            CRC64_POLYNOMIAL_ECMA182                0x42F0E1EBA9EA3693L
 
-
-struct _hexin_crc64 {
-    unsigned int  is_initial;
-    unsigned int  is_gradual;
-    unsigned int  width;
-    unsigned long long  poly;
-    unsigned long long  init;
-    unsigned int  refin;
-    unsigned int  refout;
-    unsigned long long  xorout;
-    unsigned long long  result;
-    unsigned long long  table[MAX_TABLE_ARRAY];
-};
-
-
-unsigned long long hexin_reverse64( unsigned long long data );
-
-unsigned char hexin_crc64_init_table_poly_is_high( unsigned long long polynomial, unsigned long long *table );
-unsigned char hexin_crc64_init_table_poly_is_low(  unsigned long long polynomial, unsigned long long *table );
-
-unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc64 *param, unsigned long long init );
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         crc64
+#define                 HEXIN_CORE_TYPE                         unsigned long long
+#define                 HEXIN_CORE_BITS                         64
+#include "_hexin_core.h"
 
 #endif //__CRC64_TABLES_H__
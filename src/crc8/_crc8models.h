@@ -0,0 +1,37 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc8models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc8 of _crc8module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc8gentables.h ) and by _crc8module.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly  init  refin   refout  xorout */
+HEXIN_MODEL( crc8_param_maxim,             8,     0x31, 0x00, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_rohc,              8,     0x07, 0xFF, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_itu8,              8,     0x07, 0x00, FALSE,  FALSE,  0x55 )
+HEXIN_MODEL( crc8_param_crc8,              8,     0x07, 0x00, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_autosar8,          8,     0x2F, 0xFF, FALSE,  FALSE,  0xFF )
+HEXIN_MODEL( crc8_param_lte8,              8,     0x9B, 0x00, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_wcdma,             8,     0x9B, 0x00, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_j1850,             8,     0x1D, 0xFF, FALSE,  FALSE,  0xFF )
+HEXIN_MODEL( crc8_param_icode,             8,     0x1D, 0xFD, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_gsm8a,             8,     0x1D, 0x00, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_gsm8b,             8,     0x49, 0x00, FALSE,  FALSE,  0xFF )
+HEXIN_MODEL( crc8_param_nrsc5,             8,     0x31, 0xFF, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_bluetooth,         8,     0xA7, 0x00, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_dvbs2,             8,     0xD5, 0x00, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_ebu8,              8,     0x1D, 0xFF, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_darc,              8,     0x39, 0x00, TRUE,   TRUE,   0x00 )
+HEXIN_MODEL( crc8_param_opensafety8,       8,     0x2F, 0x00, FALSE,  FALSE,  0x00 )
+HEXIN_MODEL( crc8_param_mifare_mad,        8,     0x1D, 0xC7, FALSE,  FALSE,  0x00 )
@@ -28,74 +28,112 @@
 *                       2020-11-18 [Heyn] Fixed (Python2) Parsing arguments has no 'p' type
 *                       2021-06-07 [Heyn] Add hacker8() reinit parameter. reinit=True -> Reinitialize the table
 *                       2022-03-04 [Heyn] New add modbus(ASCII) checksum(LRC).
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, batch() hashes frames in lockstep ( compute_multi ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc8models.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 *********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crc8tables.h"
+#include "_crc8gentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc8models.h ), the tables are the ones generated by setup.py ( _crc8gentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc8 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crc8models.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc8 *param;
+} hexin_crc8_models[] = {
+    { "maxim8",      &crc8_param_maxim },
+    { "rohc",        &crc8_param_rohc },
+    { "itu8",        &crc8_param_itu8 },
+    { "i432_1",      &crc8_param_itu8 },
+    { "crc8",        &crc8_param_crc8 },
+    { "smbus",       &crc8_param_crc8 },
+    { "autosar8",    &crc8_param_autosar8 },
+    { "lte8",        &crc8_param_lte8 },
+    { "sae_j1850",   &crc8_param_j1850 },
+    { "icode8",      &crc8_param_icode },
+    { "gsm8_a",      &crc8_param_gsm8a },
+    { "gsm8_b",      &crc8_param_gsm8b },
+    { "nrsc_5",      &crc8_param_nrsc5 },
+    { "wcdma8",      &crc8_param_wcdma },
+    { "bluetooth",   &crc8_param_bluetooth },
+    { "dvb_s2",      &crc8_param_dvbs2 },
+    { "ebu8",        &crc8_param_ebu8 },
+    { "tech_3250",   &crc8_param_ebu8 },
+    { "aes8",        &crc8_param_ebu8 },
+    { "darc8",       &crc8_param_darc },
+    { "opensafety8", &crc8_param_opensafety8 },
+    { "mifare_mad",  &crc8_param_mifare_mad },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#define                 HEXIN_MODULE_NAME                       crc8
+#define                 HEXIN_MODULE_TYPE                       unsigned char
+#define                 HEXIN_MODULE_BITS                       8
+#define                 HEXIN_MODULE_TITLE                      "CRC8"
+#define                 HEXIN_MODULE_HACKER                     "hacker8"
+#define                 HEXIN_MODULE_HACKER_PARAM               { .is_initial = FALSE,                     \
+                                                                  .width  = HEXIN_CRC8_WIDTH,               \
+                                                                  .poly   = CRC8_POLYNOMIAL_31,             \
+                                                                  .init   = 0xFF,                           \
+                                                                  .refin  = FALSE,                          \
+                                                                  .refout = FALSE,                          \
+                                                                  .xorout = 0x00 }
+#include "_hexin_module.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS,
                                              unsigned char init,
                                              unsigned char (*function)( const unsigned char *,
-                                                                        unsigned int,
+                                                                        size_t,
                                                                         unsigned char ),
                                              unsigned char *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned long long value = init;
+    PyObject *values[2];
+    static const char* kwlist[]={ "data", "init", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return TRUE;
-}
-
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc8 *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned char init = param->init;
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_NOKW_PASS, NULL, kwlist, 1, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[1], &value ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned char )value;
 
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
     }
-    
-    param->result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -103,124 +141,96 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc8_intel( PyObject *self, PyObject *args )
+static PyObject * _crc8_intel( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_bcc( PyObject *self, PyObject *args )
+static PyObject * _crc8_bcc( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_lrc( PyObject *self, PyObject *args )
+static PyObject * _crc8_lrc( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_maxim( PyObject *self, PyObject *args )
+static PyObject * _crc8_maxim( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_maxim = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_maxim, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_maxim.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_rohc( PyObject *self, PyObject *args )
+static PyObject * _crc8_rohc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_rohc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_rohc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_itu( PyObject *self, PyObject *args )
+static PyObject * _crc8_itu( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_itu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x55,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_itu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_itu8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_itu8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_crc8( PyObject *self, PyObject *args )
+static PyObject * _crc8_crc8( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_crc8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_crc8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_crc8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_crc8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_sum( PyObject *self, PyObject *args )
+static PyObject * _crc8_sum( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 static PyObject * _crc8_table( PyObject *self, PyObject *args )
@@ -242,7 +252,7 @@ static PyObject * _crc8_table( PyObject *self, PyObject *args )
     if ( FALSE == ref ) {
         hexin_crc8_init_table_poly_is_low ( poly, table );
     } else {
-        hexin_crc8_init_table_poly_is_high( hexin_reverse8( poly ), table );
+        hexin_crc8_init_table_poly_is_high( hexin_crc8_reverse( poly ), table );
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
@@ -252,333 +262,182 @@ static PyObject * _crc8_table( PyObject *self, PyObject *args )
     return plist;
 }
 
-static PyObject * _crc8_hacker( PyObject *self, PyObject *args, PyObject* kws )
-{
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc8 crc8_param_hacker = { .is_initial = FALSE,
-                                                    .is_gradual = FALSE,
-                                                    .width  = HEXIN_CRC8_WIDTH,
-                                                    .poly   = CRC8_POLYNOMIAL_31,
-                                                    .init   = 0xFF,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x00,
-                                                    .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|BBBppp", kwlist, &data,
-                                                                       &crc8_param_hacker.poly,
-                                                                       &crc8_param_hacker.init,
-                                                                       &crc8_param_hacker.xorout,
-                                                                       &crc8_param_hacker.refin,
-                                                                       &crc8_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;
-    }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|BBBIII", kwlist, &data,
-                                                                       &crc8_param_hacker.poly,
-                                                                       &crc8_param_hacker.init,
-                                                                       &crc8_param_hacker.xorout,
-                                                                       &crc8_param_hacker.refin,
-                                                                       &crc8_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    crc8_param_hacker.is_initial = ( reinit == FALSE ) ? crc8_param_hacker.is_initial : FALSE;
-    crc8_param_hacker.result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc8_param_hacker, crc8_param_hacker.init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
-
-    return Py_BuildValue( "B", crc8_param_hacker.result );
-}
-
-static PyObject * _crc8_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc8_fletcher( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
-    unsigned char result   = 0x00;
-    unsigned char reserved = 0x00;
+    unsigned char result = 0x00;
+    unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_autosar8( PyObject *self, PyObject *args )
+static PyObject * _crc8_autosar8( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_autosar8 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC8_WIDTH,
-                                                      .poly   = CRC8_POLYNOMIAL_2F,
-                                                      .init   = 0xFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0xFF,
-                                                      .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_autosar8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_autosar8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_autosar8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_lte8( PyObject *self, PyObject *args )
+static PyObject * _crc8_lte8( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_lte8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_9B,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_lte8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_lte8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_lte8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_wcdma( PyObject *self, PyObject *args )
+static PyObject * _crc8_wcdma( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_wcdma = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_9B,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_wcdma ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_wcdma, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_wcdma.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_sae_j1850( PyObject *self, PyObject *args )
+static PyObject * _crc8_sae_j1850( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_j1850 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_j1850 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_j1850, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_j1850.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_icode( PyObject *self, PyObject *args )
+static PyObject * _crc8_icode( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_icode = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFD,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_icode ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_icode, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_icode.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_gsm8_a( PyObject *self, PyObject *args )
+static PyObject * _crc8_gsm8_a( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8a = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_gsm8a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8a.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_gsm8_b( PyObject *self, PyObject *args )
+static PyObject * _crc8_gsm8_b( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8b = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_49,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8b ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_gsm8b, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8b.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_nrsc_5( PyObject *self, PyObject *args )
+static PyObject * _crc8_nrsc_5( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_nrsc5 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_nrsc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_nrsc5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_nrsc5.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_bluetooth( PyObject *self, PyObject *args )
+static PyObject * _crc8_bluetooth( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_bluetooth = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC8_WIDTH,
-                                                       .poly   = CRC8_POLYNOMIAL_A7,
-                                                       .init   = 0x00,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0x00,
-                                                       .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_bluetooth ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_bluetooth, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_bluetooth.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_dvb_s2( PyObject *self, PyObject *args )
+static PyObject * _crc8_dvb_s2( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_dvbs2 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_D5,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_dvbs2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_dvbs2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_dvbs2.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_ebu8( PyObject *self, PyObject *args )
+static PyObject * _crc8_ebu8( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_ebu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_1D,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_ebu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_ebu8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_ebu8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_darc( PyObject *self, PyObject *args )
+static PyObject * _crc8_darc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_darc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_39,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_darc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_opensafety8( PyObject *self, PyObject *args )
+static PyObject * _crc8_opensafety8( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_opensafety8 = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC8_WIDTH,
-                                                         .poly   = CRC8_POLYNOMIAL_2F,
-                                                         .init   = 0x00,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x00,
-                                                         .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_opensafety8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_opensafety8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_opensafety8.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_mifare_mad( PyObject *self, PyObject *args )
+static PyObject * _crc8_mifare_mad( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crc8 crc8_param_mifare_mad = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC8_WIDTH,
-                                                        .poly   = CRC8_POLYNOMIAL_1D,
-                                                        .init   = 0xC7,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00,
-                                                        .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_mifare_mad ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc8_param_mifare_mad, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_mifare_mad.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_lin( PyObject *self, PyObject *args )
+static PyObject * _crc8_lin( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lin, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_lin, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
@@ -604,7 +463,7 @@ static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
     }
 #endif /* PY_MAJOR_VERSION */
 
-    crc = hexin_calc_crc8_lin2x( ( const unsigned char * )data.buf, (unsigned int)data.len, 0 );
+    crc = hexin_calc_crc8_lin2x( ( const unsigned char * )data.buf, (size_t)data.len, 0 );
     pid = hexin_crc8_get_lin2x_pid( (( const unsigned char * )data.buf)[0] );
 
     pDict = PyDict_New();
@@ -617,12 +476,12 @@ static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
     return Py_INCREF( pDict ), pDict;
 }
 
-static PyObject * _crc8_id8( PyObject *self, PyObject *args )
+static PyObject * _crc8_id8( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_id8, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_id8, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
@@ -630,28 +489,28 @@ static PyObject * _crc8_id8( PyObject *self, PyObject *args )
         Py_RETURN_NONE;
     }
 
-    return Py_BuildValue( "z#", &result, 1 );
+    return Py_BuildValue( "z#", &result, ( Py_ssize_t )1 );
 }
 
-static PyObject * _crc8_nmea( PyObject *self, PyObject *args )
+static PyObject * _crc8_nmea( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_nmea, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_crc8_nmea, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc8_modbus_asc( PyObject *self, PyObject *args )
+static PyObject * _crc8_modbus_asc( PyObject *self, HEXIN_FASTCALL_NOKW_ARGS )
 {
     unsigned char result = 0x00, tmp = 0x00;
     unsigned char init   = 0x00;
     unsigned char crc[2] = { 0x00, 0x00 };
 
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_modbus_ascii, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_NOKW_PASS, init, hexin_calc_modbus_ascii, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
@@ -660,22 +519,22 @@ static PyObject * _crc8_modbus_asc( PyObject *self, PyObject *args )
     tmp   = ( result >> 0 ) & 0x0F;
     crc[1] = ( tmp > 9 ? ( tmp - 10 + 'A' ) : ( tmp + 0x30 ) );
     
-    return Py_BuildValue( "y#", crc, 2 );
+    return Py_BuildValue( "y#", crc, ( Py_ssize_t )2 );
 }
 
 /* method table */
 static PyMethodDef _crc8Methods[] = {
-    { "intel",      (PyCFunction)_crc8_intel,        METH_VARARGS, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
-    { "bcc",        (PyCFunction)_crc8_bcc,          METH_VARARGS, "Calculate BCC(XOR) of CRC8 [Initial=0x00]" },
-    { "lrc",        (PyCFunction)_crc8_lrc,          METH_VARARGS, "Calculate LRC of CRC8 [Initial=0x00]" },
-    { "maxim8",     (PyCFunction)_crc8_maxim,        METH_VARARGS, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
-    { "rohc",       (PyCFunction)_crc8_rohc,         METH_VARARGS, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "itu8",       (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "i432_1",     (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "crc8",       (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sum8",       (PyCFunction)_crc8_sum,          METH_VARARGS, "Calculate SUM of CRC8 [Initial=0x00]" },
+    { "intel",      (PyCFunction)_crc8_intel,        HEXIN_METH_FASTCALL, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
+    { "bcc",        (PyCFunction)_crc8_bcc,          HEXIN_METH_FASTCALL, "Calculate BCC(XOR) of CRC8 [Initial=0x00]" },
+    { "lrc",        (PyCFunction)_crc8_lrc,          HEXIN_METH_FASTCALL, "Calculate LRC of CRC8 [Initial=0x00]" },
+    { "maxim8",     (PyCFunction)_crc8_maxim,        HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
+    { "rohc",       (PyCFunction)_crc8_rohc,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "itu8",       (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "i432_1",     (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL_KEYWORDS, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "crc8",       (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sum8",       (PyCFunction)_crc8_sum,          HEXIN_METH_FASTCALL, "Calculate SUM of CRC8 [Initial=0x00]" },
     { "table8",     (PyCFunction)_crc8_table,        METH_VARARGS, "Print CRC8 table to list. libscrc.table8( polynomial )" },
-    { "hacker8",    (PyCFunction)_crc8_hacker,       METH_KEYWORDS|METH_VARARGS, "User calculation CRC8\n"
+    { "hacker8",    (PyCFunction)_crc8_hacker,       HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC8\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x31\n"
                                                                                  "@init   : default=0xFF\n"
@@ -683,29 +542,30 @@ static PyMethodDef _crc8Methods[] = {
                                                                                  "@refin  : default=False\n"
                                                                                  "@refout : default=False\n"
                                                                                  "@reinit : default=False" },
-    { "fletcher8",  (PyCFunction)_crc8_fletcher,     METH_VARARGS, "Calculate fletcher8" },
-    { "smbus",      (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "autosar8",   (PyCFunction)_crc8_autosar8,     METH_VARARGS, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "lte8",       (PyCFunction)_crc8_lte8,         METH_VARARGS, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    METH_VARARGS, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "icode8",     (PyCFunction)_crc8_icode,        METH_VARARGS, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       METH_VARARGS, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       METH_VARARGS, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
-    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       METH_VARARGS, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
-    { "wcdma8",     (PyCFunction)_crc8_wcdma,        METH_VARARGS, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    METH_VARARGS, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       METH_VARARGS, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "ebu8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "tech_3250",  (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "aes8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "darc8",      (PyCFunction)_crc8_darc,         METH_VARARGS, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "opensafety8",(PyCFunction)_crc8_opensafety8,  METH_VARARGS, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   METH_VARARGS, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
-    { "lin",        (PyCFunction)_crc8_lin,          METH_VARARGS, "Calculate LIN Protocol 1.3 (CLASSIC)"   },
+    { "fletcher8",  (PyCFunction)_crc8_fletcher,     HEXIN_METH_FASTCALL, "Calculate fletcher8. libscrc.fletcher8( data, value=0 ), value goes on from a previous result" },
+    { "smbus",      (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "autosar8",   (PyCFunction)_crc8_autosar8,     HEXIN_METH_FASTCALL_KEYWORDS, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "lte8",       (PyCFunction)_crc8_lte8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "icode8",     (PyCFunction)_crc8_icode,        HEXIN_METH_FASTCALL_KEYWORDS, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
+    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       HEXIN_METH_FASTCALL_KEYWORDS, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
+    { "wcdma8",     (PyCFunction)_crc8_wcdma,        HEXIN_METH_FASTCALL_KEYWORDS, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "ebu8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "tech_3250",  (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "aes8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "darc8",      (PyCFunction)_crc8_darc,         HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "opensafety8",(PyCFunction)_crc8_opensafety8,  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
+    { "lin",        (PyCFunction)_crc8_lin,          HEXIN_METH_FASTCALL, "Calculate LIN Protocol 1.3 (CLASSIC)"   },
     { "lin2x",      (PyCFunction)_crc8_lin2x,        METH_VARARGS, "Calculate LIN Protocol 2.x (ENHANCED)"  },
-    { "id8",        (PyCFunction)_crc8_id8,          METH_VARARGS, "Calculate identity card of CHINA."      },
-    { "nmea",       (PyCFunction)_crc8_nmea,         METH_VARARGS, "Calculate NMEA Checksum. XOR of all the bytes between the $ and the * (not including the delimiters themselves)" },
-    { "modbus_asc", (PyCFunction)_crc8_modbus_asc,   METH_VARARGS, "Calculate Modbus(ASCII) Checksum."      },
+    { "id8",        (PyCFunction)_crc8_id8,          HEXIN_METH_FASTCALL, "Calculate identity card of CHINA."      },
+    { "nmea",       (PyCFunction)_crc8_nmea,         HEXIN_METH_FASTCALL, "Calculate NMEA Checksum. XOR of all the bytes between the $ and the * (not including the delimiters themselves)" },
+    { "modbus_asc", (PyCFunction)_crc8_modbus_asc,   HEXIN_METH_FASTCALL, "Calculate Modbus(ASCII) Checksum."      },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -765,6 +625,18 @@ PyInit__crc8( void )
 {
     PyObject *m = NULL;
 
+    if ( hexin_crc8_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc8_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crc8module );
     if ( m == NULL ) {
         return NULL;
@@ -782,6 +654,14 @@ PyInit__crc8( void )
 PyMODINIT_FUNC
 init_crc8( void )
 {
+    if ( hexin_crc8_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc8_compute() may run without the GIL. */
+    hexin_cpu_features();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     (void) Py_InitModule3( "_crc8", _crc8Methods, _crc8_doc );
 }
 
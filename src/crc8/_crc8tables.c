@@ -15,68 +15,29 @@
 *                       2021-03-16 [Heyn] New add ID checksum.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
 *                       2022-03-04 [Heyn] New add modbus(ASCII) checksum(LRC).
+*                       2022-05-11 [Heyn] Reflected tables for refin, no more per-byte reverse.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-10 [Heyn] compute_init() points the descriptor at the tables also when they are built ( hacker table cache ).
+*                       2022-06-12 [Heyn] The engine is _hexin_core.h ( slicing-by-8, CLMUL folding, threads, combine, batch ), same for crc8/16/24/32/64/x/canx.
 *
 *   SEE : http://reveng.sourceforge.net/crc-catalogue/1-15.htm#crc.cat-bits.8
 *
 *********************************************************************************************************
 */
 
+#define HEXIN_CORE_IMPLEMENTATION                                       /* The engine functions, see _hexin_core.h */
 #include "_crc8tables.h"
 
-unsigned char hexin_reverse8( unsigned char data )
+unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int  i = 0;
-    unsigned char t = 0;
-    for ( i=0; i<8; i++ ) {
-        t |= ( ( data >> i ) & 0x01 ) << ( 7-i );
-    }
-    return t;
-}
-
-unsigned int hexin_crc8_init_table_poly_is_high( unsigned char polynomial, unsigned char *table )
-{
-    unsigned int i = 0, j = 0;
-    unsigned char crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = i;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x01 )   crc = ( crc >> 1 ) ^ polynomial;
-            else                      crc =   crc >> 1;
-            c = c >> 1;
-        }
-        table[i] = crc;
-    }
-    return TRUE;
-}
-
-unsigned int hexin_crc8_init_table_poly_is_low( unsigned char polynomial, unsigned char *table )
-{
-    unsigned int i = 0, j = 0;
-    unsigned char crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = i;
-        for ( j=0; j<8; j++ ) {
-			if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ polynomial;
-			else                    crc =   crc << 1;
-			c = c << 1;
-        }
-        table[i] = crc;
-    }
-    return TRUE;
-}
-
-unsigned char hexin_crc8_poly_calc( unsigned char crc8, unsigned char c, const unsigned char *table )
-{
-    return table[ crc8 ^ c ];
-}
-
-unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
-{
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -86,9 +47,9 @@ unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -99,9 +60,9 @@ unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -110,73 +71,13 @@ unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ )
-{
-    unsigned int i = 0;
-    unsigned char sum1 = 0, sum2 = 0;
-
-    for ( i = 0; i < len; i++ ) {
-        sum1 += pSrc[i];
-        sum2 += sum1;
-    }
-    return ( sum1 & 0xF ) | ( sum2 << 4 );    
-}
-
-static unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param )
-{
-    unsigned int i = 0, j = 0;
-    unsigned char crc = 0, c = 0;
-
-    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = i;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ param->poly;
-            else                    crc =   crc << 1;
-            c = c << 1;
-        }
-        param->table[i] = crc;
-    }
-
-    return TRUE;
-}
-
-static unsigned char hexin_crc8_compute_char( unsigned char crc8, unsigned char c, struct _hexin_crc8 *param )
-{
-    return param->table[ crc8 ^ c ];
-}
-
-unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param, unsigned char init )
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, size_t len, unsigned char crc8 )
 {
-    unsigned int i = 0;
-    unsigned char crc = init;
-
-    if ( param->is_initial == FALSE ) {
-        param->is_initial = hexin_crc8_compute_init_table( param );
-    }
-
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
-        crc = hexin_reverse8( init );
-    }
-
-    /* Fixed Issues #8  */
-    if ( HEXIN_REFIN_IS_TRUE( param ) ) { 
-        for ( i=0; i<len; i++ ) {
-            crc = hexin_crc8_compute_char( crc, hexin_reverse8(pSrc[i]), param );
-        }
-    } else {
-        for ( i=0; i<len; i++ ) {
-            crc = hexin_crc8_compute_char( crc, pSrc[i], param );
-        }
-    }
-
-    /* Fixed Issues #8  */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
-        crc = hexin_reverse8( crc );
-    }
+    /* The 4-bit halves of the sums, modulo 256 is the same modulo 16 */
+    unsigned int sums[2] = { crc8 & 0x0F, ( crc8 >> 4 ) & 0x0F };
 
-	return ( crc ^ param->xorout );
+    hexin_fletcher_sum8( pSrc, len, 256, sums );
+    return ( unsigned char )( ( sums[0] & 0x0F ) | ( ( sums[1] & 0x0F ) << 4 ) );
 }
 
 /*
@@ -189,9 +90,9 @@ const unsigned char LIN2X_PID_TABLE[60] = { 0x80, 0xC1, 0x42, 0x03, 0xC4, 0x85,
                                             0xA8, 0xE9, 0x6A, 0x2B, 0xEC, 0xAD, 0x2E, 0x6F, 0xF0, 0xB1,
                                             0x32, 0x73, 0xB4, 0xF5, 0x76, 0x37, 0x78, 0x39, 0xBA, 0xFB };
 
-unsigned char hexin_calc_crc8_lin( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lin( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int   i   = 0;
+    size_t         i   = 0;
     unsigned short sum = ( (unsigned short)crc8 ) & 0x00FF;
 
 	for ( i=1; i<len; i++ ) {
@@ -211,7 +112,7 @@ unsigned char hexin_crc8_get_lin2x_pid( const unsigned char id )
     return ( ( p1 & 0x01 ) << 7 ) | ( ( p0 & 0x01 ) << 6 ) | id;
 }
 
-unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     unsigned char id  = pSrc[0];
 
@@ -225,12 +126,12 @@ unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, unsigned int len
 	return hexin_calc_crc8_lin( pSrc, len, hexin_crc8_get_lin2x_pid( id ) );
 }
 
-unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     const unsigned char coefficient[17] = { 7, 9, 10, 5, 8, 4, 2, 1, 6, 3, 7, 9, 10, 5, 8, 4, 2   };
     const unsigned char _last_array[11] = { '1', '0', 'X', '9', '8', '7', '6', '5', '4', '3', '2' };
     
-    unsigned int  i   = 0;
+    size_t        i   = 0;
     unsigned int  sum = crc8;
 
     if ( ( len != 17 ) || ( crc8 != 0 ) ) {
@@ -252,7 +153,7 @@ unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, unsigned int len,
     return _last_array[ sum % 11 ];
 }
 
-unsigned char hexin_calc_crc8_nmea( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_nmea( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     const unsigned char *ptr = ( const unsigned char * )pSrc;
     unsigned int  crc = crc8;
@@ -286,9 +187,9 @@ const unsigned char ascii2hex[MAX_TABLE_ARRAY] = {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 };
 
-unsigned char hexin_calc_modbus_ascii( const unsigned char *pSrc, unsigned int len, unsigned char crc8 )
+unsigned char hexin_calc_modbus_ascii( const unsigned char *pSrc, size_t len, unsigned char crc8 )
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = 0;
 
     if ( ( i % 2 ) != 0 ) {
@@ -14,6 +14,15 @@
 *                       2021-03-16 [Heyn] New add ID checksum.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
 *                       2022-03-04 [Heyn] New add modbus(ASCII) checksum(LRC).
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-08 [Heyn] fletcher sums reduced once per block ( AVX2 kernels ), the value argument goes on from a previous result.
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -21,6 +30,9 @@
 #ifndef __CRC8_TABLES_H__
 #define __CRC8_TABLES_H__
 
+#include <stddef.h>
+#include "_hexin_fletcher.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -33,13 +45,13 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
-#define                 HEXIN_CRC8_WIDTH                        16
+#define                 HEXIN_CRC8_WIDTH                        8
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x80 )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
 
 #define CRC8_POLYNOMIAL_07                                      0x07
 #define CRC8_POLYNOMIAL_31                                      0x31
@@ -51,36 +63,23 @@
 #define CRC8_POLYNOMIAL_A7                                      0xA7
 #define CRC8_POLYNOMIAL_D5                                      0xD5
 
-struct _hexin_crc8 {
-    unsigned int   is_initial;
-    unsigned int   is_gradual;
-    unsigned char  width;
-    unsigned char  poly;
-    unsigned char  init;
-    unsigned int   refin;
-    unsigned int   refout;
-    unsigned char  xorout;
-    unsigned char  result;
-    unsigned char  table[MAX_TABLE_ARRAY];
-};
-
-unsigned char hexin_reverse8( unsigned char data );
-
-unsigned int hexin_crc8_init_table_poly_is_high( unsigned char polynomial, unsigned char *table );
-unsigned int hexin_crc8_init_table_poly_is_low(  unsigned char polynomial, unsigned char *table );
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         crc8
+#define                 HEXIN_CORE_TYPE                         unsigned char
+#define                 HEXIN_CORE_BITS                         8
+#include "_hexin_core.h"
 
-unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ );
-unsigned char hexin_crc8_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param, unsigned char init );
+unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, size_t len, unsigned char crc8 );
 
 unsigned char hexin_crc8_get_lin2x_pid( const unsigned char id );
-unsigned char hexin_calc_crc8_lin(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_lin2x(    const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_id8(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_nmea(     const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lin(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lin2x(    const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_id8(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_nmea(     const unsigned char *pSrc, size_t len, unsigned char crc8 );
 
-unsigned char hexin_calc_modbus_ascii(  const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
+unsigned char hexin_calc_modbus_ascii(  const unsigned char *pSrc, size_t len, unsigned char crc8 );
 
 #endif //__CRC8_TABLES_H__
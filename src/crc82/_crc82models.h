@@ -0,0 +1,20 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc82models.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crc82 of _crc82module.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crc82gentables.h ) and by _crc82module.c for the descriptors,
+*                       the values are numbers, HEXIN_CRC82_VALUE( lo, hi ) for the 82 bits ones.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly                                                               init                                                               refin   refout  xorout */
+HEXIN_MODEL( crc82_param_darc,             82,    HEXIN_CRC82_VALUE( 0x0111011401440411ULL, 0x000000000000308CULL ), HEXIN_CRC82_VALUE( 0x0000000000000000ULL, 0x0000000000000000ULL ), TRUE,   TRUE,   HEXIN_CRC82_VALUE( 0x0000000000000000ULL, 0x0000000000000000ULL ) )
@@ -0,0 +1,611 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc82module.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-09 [Heyn] Initialize ( was the bit loop of libscrc/_crc82.py ).
+*                       darc82() goes on from its init argument, hacker82() and libscrc.new( 'darc82' ) as the other modules.
+*                       2022-06-10 [Heyn] hacker() tables cached per ( width, poly, refin, refout ), LRU of 64 models.
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crc82models.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] _new() and _kernel() are METH_FASTCALL ( hexin_fastcall_parse() ), no format strings.
+*                       2022-06-15 [Heyn] The hash objects have a lock, update() of two threads no longer loses one of them.
+*                       2022-06-15 [Heyn] hacker82() computes on the pinned cache entry, no copy of its tables.
+*                       2022-06-15 [Heyn] new( "hacker82" ) and copy() pin the cache entry too, no tables built per object.
+*                       2022-06-15 [Heyn] Cache entries are marked built ( hexin_cache_built() ) once filled.
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "_crc82tables.h"
+#include "_crc82gentables.h"
+#include "_hexin_fastcall.h"
+#include "_hexin_lock.h"
+#include "_hexin_cache.h"
+#include "_hexin_cpu.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crc82models.h ), the tables are the ones generated by setup.py ( _crc82gentables.h ). */
+#define HEXIN_CRC82_VALUE( lo, hi )     { lo, hi }
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crc82 param = { TRUE, width, poly, init, refin, refout, xorout, param##_table };
+#include "_crc82models.h"
+#undef HEXIN_MODEL
+
+/* Like hexin_fastcall_unsigned(), the low 82 bits of an integer, value is left alone when obj is NULL. */
+static int hexin_crc82_from_object( PyObject *obj, struct _hexin_crc82_value *value )
+{
+    PyObject *shift = NULL, *hi = NULL;
+    unsigned long long result = 0;
+
+    if ( obj == NULL ) {
+        return TRUE;
+    }
+
+    if ( !hexin_fastcall_unsigned( obj, &result ) ) {
+        return FALSE;
+    }
+
+    shift = PyLong_FromLong( 64 );
+    if ( shift == NULL ) {
+        return FALSE;
+    }
+    hi = PyNumber_Rshift( obj, shift );
+    Py_DECREF( shift );
+    if ( hi == NULL ) {
+        return FALSE;
+    }
+
+    value->lo = result;
+    if ( !hexin_fastcall_unsigned( hi, &result ) ) {
+        Py_DECREF( hi );
+        return FALSE;
+    }
+    Py_DECREF( hi );
+    value->hi = result & HEXIN_CRC82_HI_MASK;
+    return TRUE;
+}
+
+/* hi << 64 | lo */
+static PyObject * hexin_PyLong_FromCrc82( struct _hexin_crc82_value value )
+{
+    PyObject *hi = NULL, *lo = NULL, *shift = NULL, *upper = NULL, *result = NULL;
+
+    if ( value.hi == 0 ) {
+        return PyLong_FromUnsignedLongLong( value.lo );
+    }
+
+    hi    = PyLong_FromUnsignedLongLong( value.hi );
+    lo    = PyLong_FromUnsignedLongLong( value.lo );
+    shift = PyLong_FromLong( 64 );
+    if ( ( hi != NULL ) && ( lo != NULL ) && ( shift != NULL ) ) {
+        upper = PyNumber_Lshift( hi, shift );
+        if ( upper != NULL ) {
+            result = PyNumber_Or( upper, lo );
+        }
+    }
+
+    Py_XDECREF( hi );
+    Py_XDECREF( lo );
+    Py_XDECREF( shift );
+    Py_XDECREF( upper );
+    return result;
+}
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_ARGS, const struct _hexin_crc82 *param, struct _hexin_crc82_value *result )
+{
+    Py_buffer data = { NULL, NULL };
+    unsigned int is_gradual = 0;
+    struct _hexin_crc82_value init = param->init;
+    PyObject *values[2];
+    static const char* kwlist[]={ "data", "init", NULL };
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) ||
+         !hexin_crc82_from_object( values[1], &init ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
+        return FALSE;
+    }
+
+    /* Fixed Issues #4  : init ( positional or init=... ) goes on from a previous result */
+    is_gradual = ( values[1] != NULL ) ? 2 : 1;
+    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) {
+        init.lo ^= param->xorout.lo;
+        init.hi ^= param->xorout.hi;
+    }
+
+    /* The tables are generated by setup.py, param is read-only here. */
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc82_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init, is_gradual );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc82_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init, is_gradual );
+    }
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return TRUE;
+}
+
+static PyObject * _crc82_darc82( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    struct _hexin_crc82_value result = { 0, 0 };
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc82_param_darc, &result ) ) {
+        return NULL;
+    }
+
+    return hexin_PyLong_FromCrc82( result );
+}
+
+/* Tables of the recent hacker82 models ( LRU ), the GIL protects the cache, a pinned entry stays valid without it. */
+static struct _hexin_cache crc82_cache_hacker;
+
+/* Pinned cache entry of the tables of hacker, built when new, hacker points at it. Release with hexin_cache_release(). */
+static struct _hexin_crc82_tables *hexin_crc82_hacker_tables( struct _hexin_crc82 *hacker )
+{
+    unsigned int is_built = FALSE;
+    struct _hexin_crc82_tables *tables = hexin_cache_lookup( &crc82_cache_hacker, hacker->width, hacker->poly.lo, hacker->poly.hi,
+                                                             hacker->refin, hacker->refout, sizeof( struct _hexin_crc82_tables ), FALSE, &is_built );
+
+    if ( tables == NULL ) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    hacker->is_initial = is_built;
+    if ( hexin_crc82_compute_init( hacker, tables ) ) {
+        hexin_cache_built( &crc82_cache_hacker, tables );
+    }
+    return tables;
+}
+
+static PyObject * _crc82_hacker( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned int reinit = FALSE, is_built = FALSE;
+    Py_buffer data = { NULL, NULL };
+
+    static struct _hexin_crc82 crc82_param_hacker = { .is_initial = FALSE,
+                                                      .width  = HEXIN_CRC82_WIDTH,
+                                                      .poly   = { CRC82_POLYNOMIAL_DARC_LO, CRC82_POLYNOMIAL_DARC_HI },
+                                                      .init   = { 0x0000000000000000ULL, 0x0000000000000000ULL },
+                                                      .refin  = FALSE,
+                                                      .refout = FALSE,
+                                                      .xorout = { 0x0000000000000000ULL, 0x0000000000000000ULL } };
+    struct _hexin_crc82 param;
+    struct _hexin_crc82_tables *tables = NULL;
+
+    struct _hexin_crc82_value result = { 0, 0 };
+    static const char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    unsigned int is_refin = crc82_param_hacker.refin, is_refout = crc82_param_hacker.refout;
+    struct _hexin_crc82_value poly = crc82_param_hacker.poly, init = crc82_param_hacker.init, xorout = crc82_param_hacker.xorout;
+    PyObject *values[7];
+
+    /* A parameter passed stays for the next calls. */
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) ||
+         !hexin_crc82_from_object( values[1], &poly   ) ||
+         !hexin_crc82_from_object( values[2], &init   ) ||
+         !hexin_crc82_from_object( values[3], &xorout ) ||
+         !hexin_fastcall_bool( values[4], &is_refin  ) ||
+         !hexin_fastcall_bool( values[5], &is_refout ) ||
+         !hexin_fastcall_bool( values[6], &reinit ) ||
+         !hexin_fastcall_buffer( values[0], &data ) ) {
+        return NULL;
+    }
+    crc82_param_hacker.poly   = poly;
+    crc82_param_hacker.init   = init;
+    crc82_param_hacker.xorout = xorout;
+    crc82_param_hacker.refin  = is_refin;
+    crc82_param_hacker.refout = is_refout;
+
+    /* The tables of the recent models stay built ( LRU ), reinit=True rebuilds the ones of this model. */
+    tables = hexin_cache_lookup( &crc82_cache_hacker, crc82_param_hacker.width, crc82_param_hacker.poly.lo, crc82_param_hacker.poly.hi,
+                                 crc82_param_hacker.refin, crc82_param_hacker.refout, sizeof( struct _hexin_crc82_tables ), reinit, &is_built );
+    if ( tables == NULL ) {
+        if ( data.obj )
+           PyBuffer_Release( &data );
+        return PyErr_NoMemory();
+    }
+    param = crc82_param_hacker;
+    param.is_initial = is_built;
+    if ( hexin_crc82_compute_init( &param, tables ) ) {
+        hexin_cache_built( &crc82_cache_hacker, tables );
+    }
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        /* The entry is pinned, no other thread evicts or rebuilds it. */
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc82_compute( (const unsigned char *)data.buf, (size_t)data.len, &param, param.init, FALSE );
+        Py_END_ALLOW_THREADS
+    } else {
+        result = hexin_crc82_compute( (const unsigned char *)data.buf, (size_t)data.len, &param, param.init, FALSE );
+    }
+    hexin_cache_release( &crc82_cache_hacker, tables );
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return hexin_PyLong_FromCrc82( result );
+}
+
+/*
+ * Incremental ( hashlib style ) objects of libscrc.new( name ).
+ * crc is the raw register of hexin_crc82_compute_start() / _update(), digest() applies _final().
+ * lock serializes update() / digest() / copy() of threads sharing an object, once an update() released the GIL ( _hexin_lock.h ).
+ */
+typedef struct {
+    PyObject_HEAD
+    const char          *name;
+    struct _hexin_crc82   param;
+    struct _hexin_crc82_tables     *tables;                    /* hacker82 only, pinned cache entry, param points at it */
+    struct _hexin_crc82_value crc;
+    PyThread_type_lock  lock;
+} hexin_crc82_hash;
+
+static PyTypeObject hexin_crc82_hash_type = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+
+static hexin_crc82_hash *hexin_crc82_hash_alloc( const char *name, const struct _hexin_crc82 *param, struct _hexin_crc82_value crc )
+{
+    hexin_crc82_hash *self = PyObject_New( hexin_crc82_hash, &hexin_crc82_hash_type );
+
+    if ( self == NULL ) {
+        return NULL;
+    }
+    self->name   = name;
+    self->param  = *param;
+    self->tables = NULL;
+    self->crc    = crc;
+    self->lock   = NULL;
+    return self;
+}
+
+static void hexin_crc82_hash_dealloc( hexin_crc82_hash *self )
+{
+    hexin_cache_release( &crc82_cache_hacker, self->tables );
+    hexin_lock_free( self->lock );
+    PyObject_Del( self );
+}
+
+static unsigned char hexin_crc82_hash_update_object( hexin_crc82_hash *self, PyObject *object )
+{
+    Py_buffer data = { NULL, NULL };
+
+    if ( PyObject_GetBuffer( object, &data, PyBUF_SIMPLE ) < 0 ) {
+        return FALSE;
+    }
+
+    if ( ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) && !hexin_lock_prepare( &self->lock ) ) {
+        PyBuffer_Release( &data );
+        return FALSE;
+    }
+
+    hexin_lock_acquire( self->lock );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        self->crc = hexin_crc82_compute_update( (const unsigned char *)data.buf, (size_t)data.len, &self->param, self->crc );
+        Py_END_ALLOW_THREADS
+    } else {
+        self->crc = hexin_crc82_compute_update( (const unsigned char *)data.buf, (size_t)data.len, &self->param, self->crc );
+    }
+    hexin_lock_release( self->lock );
+
+    PyBuffer_Release( &data );
+    return TRUE;
+}
+
+/* The register, once an update() of another thread is done. */
+static struct _hexin_crc82_value hexin_crc82_hash_crc( hexin_crc82_hash *self )
+{
+    struct _hexin_crc82_value crc = { 0, 0 };
+
+    hexin_lock_acquire( self->lock );
+    crc = self->crc;
+    hexin_lock_release( self->lock );
+    return crc;
+}
+
+static Py_ssize_t hexin_crc82_hash_size( hexin_crc82_hash *self )
+{
+    return ( Py_ssize_t )( ( self->param.width + 7 ) / 8 );
+}
+
+static PyObject * hexin_crc82_hash_update( hexin_crc82_hash *self, PyObject *args )
+{
+    PyObject *data = NULL;
+
+    if ( !PyArg_ParseTuple( args, "O", &data ) ) {
+        return NULL;
+    }
+    if ( !hexin_crc82_hash_update_object( self, data ) ) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject * hexin_crc82_hash_digest( hexin_crc82_hash *self, PyObject *unused )
+{
+    unsigned char digest[16] = { 0 };
+    struct _hexin_crc82_value value = hexin_crc82_compute_final( &self->param, hexin_crc82_hash_crc( self ) );
+    Py_ssize_t i = 0, size = hexin_crc82_hash_size( self );
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = ( unsigned char )( value.lo & 0xFF );
+        value.lo = ( value.lo >> 8 ) | ( value.hi << 56 );
+        value.hi >>= 8;
+    }
+    return PyBytes_FromStringAndSize( ( const char * )digest, size );
+}
+
+static PyObject * hexin_crc82_hash_hexdigest( hexin_crc82_hash *self, PyObject *unused )
+{
+    static const char hex[] = "0123456789abcdef";
+    char digest[32] = { 0 };
+    struct _hexin_crc82_value value = hexin_crc82_compute_final( &self->param, hexin_crc82_hash_crc( self ) );
+    Py_ssize_t i = 0, size = hexin_crc82_hash_size( self ) * 2;
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = hex[ value.lo & 0x0F ];
+        value.lo = ( value.lo >> 4 ) | ( value.hi << 60 );
+        value.hi >>= 4;
+    }
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromStringAndSize( digest, size );
+#else
+    return PyString_FromStringAndSize( digest, size );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * hexin_crc82_hash_intdigest( hexin_crc82_hash *self, PyObject *unused )
+{
+    return hexin_PyLong_FromCrc82( hexin_crc82_compute_final( &self->param, hexin_crc82_hash_crc( self ) ) );
+}
+
+static PyObject * hexin_crc82_hash_copy( hexin_crc82_hash *self, PyObject *unused )
+{
+    hexin_crc82_hash *copy = hexin_crc82_hash_alloc( self->name, &self->param, hexin_crc82_hash_crc( self ) );
+
+    if ( copy == NULL ) {
+        return NULL;
+    }
+
+    if ( self->tables != NULL ) {
+        copy->tables = hexin_crc82_hacker_tables( &copy->param );
+        if ( copy->tables == NULL ) {
+            Py_DECREF( copy );
+            return NULL;
+        }
+    }
+    return ( PyObject * )copy;
+}
+
+static PyObject * hexin_crc82_hash_get_name( hexin_crc82_hash *self, void *closure )
+{
+    return Py_BuildValue( "s", self->name );
+}
+
+static PyObject * hexin_crc82_hash_get_digest_size( hexin_crc82_hash *self, void *closure )
+{
+    return Py_BuildValue( "n", hexin_crc82_hash_size( self ) );
+}
+
+static PyMethodDef hexin_crc82_hash_methods[] = {
+    { "update",    (PyCFunction)hexin_crc82_hash_update,    METH_VARARGS, "Update the CRC with the bytes of data" },
+    { "digest",    (PyCFunction)hexin_crc82_hash_digest,    METH_NOARGS,  "CRC of the data passed so far, as big-endian bytes" },
+    { "hexdigest", (PyCFunction)hexin_crc82_hash_hexdigest, METH_NOARGS,  "Like digest(), as a string of hexadecimal digits" },
+    { "intdigest", (PyCFunction)hexin_crc82_hash_intdigest, METH_NOARGS,  "Like digest(), as the integer the model function returns" },
+    { "copy",      (PyCFunction)hexin_crc82_hash_copy,      METH_NOARGS,  "Copy of the object, to share the CRC of a common prefix" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_crc82_hash_getset[] = {
+    { "name",        (getter)hexin_crc82_hash_get_name,        NULL, "Name of the CRC model", NULL },
+    { "digest_size", (getter)hexin_crc82_hash_get_digest_size, NULL, "Size of digest() in bytes", NULL },
+    { NULL, NULL, NULL, NULL, NULL }    /* Sentinel */
+};
+
+static int hexin_crc82_hash_type_ready( void )
+{
+    hexin_crc82_hash_type.tp_name      = "libscrc._crc82.crc82_hash";
+    hexin_crc82_hash_type.tp_basicsize = sizeof( hexin_crc82_hash );
+    hexin_crc82_hash_type.tp_dealloc   = ( destructor )hexin_crc82_hash_dealloc;
+    hexin_crc82_hash_type.tp_flags     = Py_TPFLAGS_DEFAULT;
+    hexin_crc82_hash_type.tp_doc       = "Incremental CRC82 object, see libscrc.new()";
+    hexin_crc82_hash_type.tp_methods   = hexin_crc82_hash_methods;
+    hexin_crc82_hash_type.tp_getset    = hexin_crc82_hash_getset;
+    return PyType_Ready( &hexin_crc82_hash_type );
+}
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crc82 *param;
+} hexin_crc82_models[] = {
+    { "darc82",  &crc82_param_darc },
+    { NULL, NULL }
+};
+
+static PyObject * _crc82_new( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned int i = 0;
+    const char *name = NULL;
+    hexin_crc82_hash *hash = NULL;
+    const struct _hexin_crc82 *param = NULL;
+    static const char* kwlist[]={ "name", "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    PyObject *values[7];
+    Py_ssize_t count = hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values );
+    struct _hexin_crc82 hacker = { .is_initial = FALSE,
+                                   .width  = HEXIN_CRC82_WIDTH,
+                                   .poly   = { CRC82_POLYNOMIAL_DARC_LO, CRC82_POLYNOMIAL_DARC_HI },
+                                   .init   = { 0x0000000000000000ULL, 0x0000000000000000ULL },
+                                   .refin  = FALSE,
+                                   .refout = FALSE,
+                                   .xorout = { 0x0000000000000000ULL, 0x0000000000000000ULL } };
+
+    if ( ( count < 0 ) || !hexin_fastcall_string( values[0], &name ) ||
+         !hexin_fastcall_bool( values[5], &hacker.refin  ) ||
+         !hexin_fastcall_bool( values[6], &hacker.refout ) ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc82_models[i].name != NULL; i++ ) {
+        if ( strcmp( hexin_crc82_models[i].name, name ) == 0 ) {
+            param = hexin_crc82_models[i].param;
+            name  = hexin_crc82_models[i].name;
+            break;
+        }
+    }
+
+    if ( param != NULL ) {
+        if ( count > 2 ) {
+            PyErr_Format( PyExc_TypeError, "%s takes no poly, init, xorout, refin or refout ( hacker82 does )", name );
+            return NULL;
+        }
+        hash = hexin_crc82_hash_alloc( name, param, hexin_crc82_compute_start( param, param->init, FALSE ) );
+    } else if ( strcmp( name, "hacker82" ) == 0 ) {
+        if ( !hexin_crc82_from_object( values[2], &hacker.poly   ) ||
+             !hexin_crc82_from_object( values[3], &hacker.init   ) ||
+             !hexin_crc82_from_object( values[4], &hacker.xorout ) ) {
+            return NULL;
+        }
+        hash = hexin_crc82_hash_alloc( "hacker82", &hacker, hexin_crc82_compute_start( &hacker, hacker.init, FALSE ) );
+        if ( hash == NULL ) {
+            return NULL;
+        }
+        hash->tables = hexin_crc82_hacker_tables( &hash->param );
+        if ( hash->tables == NULL ) {
+            Py_DECREF( hash );
+            return NULL;
+        }
+    } else {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+
+    if ( hash == NULL ) {
+        return NULL;
+    }
+
+    if ( ( values[1] != NULL ) && ( values[1] != Py_None ) && !hexin_crc82_hash_update_object( hash, values[1] ) ) {
+        Py_DECREF( hash );
+        return NULL;
+    }
+    return ( PyObject * )hash;
+}
+
+/* The kernel of a model on this CPU ( capped by LIBSCRC_KERNEL ), use libscrc.kernel_for() */
+static PyObject * _crc82_kernel( PyObject *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned int i = 0;
+    const char *name = NULL;
+    const struct _hexin_crc82 *param = NULL;
+    static const char* kwlist[]={ "name", NULL };
+    PyObject *values[1];
+    struct _hexin_crc82 hacker = { .is_initial = FALSE,
+                                   .width  = HEXIN_CRC82_WIDTH,
+                                   .poly   = { CRC82_POLYNOMIAL_DARC_LO, CRC82_POLYNOMIAL_DARC_HI },
+                                   .init   = { 0x0000000000000000ULL, 0x0000000000000000ULL },
+                                   .refin  = FALSE,
+                                   .refout = FALSE,
+                                   .xorout = { 0x0000000000000000ULL, 0x0000000000000000ULL } };
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) || !hexin_fastcall_string( values[0], &name ) ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc82_models[i].name != NULL; i++ ) {
+        if ( strcmp( hexin_crc82_models[i].name, name ) == 0 ) {
+            param = hexin_crc82_models[i].param;
+            break;
+        }
+    }
+
+    if ( ( param == NULL ) && ( strcmp( name, "hacker82" ) == 0 ) ) {
+        param = &hacker;            /* Its default model */
+    }
+
+    if ( param == NULL ) {
+        Py_RETURN_NONE;             /* Not a model of this module */
+    }
+    return Py_BuildValue( "s", hexin_cpu_kernel_name( hexin_crc82_compute_kernel( param ) ) );
+}
+
+/* method table */
+static PyMethodDef _crc82Methods[] = {
+    { "darc82",      (PyCFunction)_crc82_darc82,  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DARC of CRC82 [Poly=0x0308C0111011401440411, Init=0x000000000000000000000, refin=True, refout=True, xorout=0x000000000000000000000]" },
+    { "hacker82",    (PyCFunction)_crc82_hacker,  HEXIN_METH_FASTCALL_KEYWORDS, "User calculation CRC82\n"
+                                                                              "@data   : bytes\n"
+                                                                              "@poly   : default=0x0308C0111011401440411\n"
+                                                                              "@init   : default=0x000000000000000000000\n"
+                                                                              "@xorout : default=0x000000000000000000000\n"
+                                                                              "@ref    : default=False" },
+    { "_new",  (PyCFunction)_crc82_new,           HEXIN_METH_FASTCALL_KEYWORDS, "Incremental object of a model, use libscrc.new()" },
+    { "_kernel",  (PyCFunction)_crc82_kernel,     HEXIN_METH_FASTCALL_KEYWORDS, "The kernel of a model on this CPU, use libscrc.kernel_for()" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+
+/* module documentation */
+PyDoc_STRVAR( _crc82_doc,
+"Calculation of CRC82 \n"
+"Author : Heyn \n"
+"libscrc.darc82   -> Calculate DARC of CRC82 [Poly=0x0308C0111011401440411, Init=0x000000000000000000000, refin=True, refout=True, xorout=0x000000000000000000000]\n"
+"libscrc.hacker82 -> Free calculation CRC82 Xorout=0 Refin=False Refout=False\n"
+"\n" );
+
+
+#if PY_MAJOR_VERSION >= 3
+
+/* module definition structure */
+static struct PyModuleDef _crc82module = {
+   PyModuleDef_HEAD_INIT,
+   "_crc82",                    /* name of module */
+   _crc82_doc,                  /* module documentation, may be NULL */
+   -1,                          /* size of per-interpreter state of the module */
+   _crc82Methods
+};
+
+/* initialization function for Python 3 */
+PyMODINIT_FUNC
+PyInit__crc82( void )
+{
+    PyObject *m;
+
+    if ( hexin_crc82_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc82_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    m = PyModule_Create( &_crc82module );
+    if ( m == NULL ) {
+        return NULL;
+    }
+
+    PyModule_AddStringConstant( m, "__version__", "1.8" );
+    PyModule_AddStringConstant( m, "__author__",  "Heyn");
+
+    return m;
+}
+
+#else
+
+/* initialization function for Python 2 */
+PyMODINIT_FUNC
+init_crc82( void )
+{
+    if ( hexin_crc82_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crc82_compute() may run without the GIL. */
+    hexin_cpu_features();
+    (void) Py_InitModule3( "_crc82", _crc82Methods, _crc82_doc );
+}
+
+#endif /* PY_MAJOR_VERSION */
@@ -0,0 +1,251 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc82tables.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-09 [Heyn] Initialize ( was the bit loop of libscrc/_crc82.py ).
+*                       2022-06-10 [Heyn] compute_init() points the descriptor at the tables also when they are built ( hacker table cache ).
+*                       2022-06-13 [Heyn] The byte loop only for the scalar kernel ( LIBSCRC_KERNEL=scalar ), new add compute_kernel().
+*
+*   SEE : http://reveng.sourceforge.net/crc-catalogue/17plus.htm#crc.cat.crc-82-darc
+*
+*********************************************************************************************************
+*/
+
+#include "_crc82tables.h"
+#include "_hexin_cpu.h"
+
+static unsigned long long hexin_reverse64( unsigned long long data )
+{
+    data = ( ( data >>  1 ) & 0x5555555555555555ULL ) | ( ( data & 0x5555555555555555ULL ) <<  1 );
+    data = ( ( data >>  2 ) & 0x3333333333333333ULL ) | ( ( data & 0x3333333333333333ULL ) <<  2 );
+    data = ( ( data >>  4 ) & 0x0F0F0F0F0F0F0F0FULL ) | ( ( data & 0x0F0F0F0F0F0F0F0FULL ) <<  4 );
+    data = ( ( data >>  8 ) & 0x00FF00FF00FF00FFULL ) | ( ( data & 0x00FF00FF00FF00FFULL ) <<  8 );
+    data = ( ( data >> 16 ) & 0x0000FFFF0000FFFFULL ) | ( ( data & 0x0000FFFF0000FFFFULL ) << 16 );
+    data = ( ( data >> 32 ) & 0x00000000FFFFFFFFULL ) | ( ( data & 0x00000000FFFFFFFFULL ) << 32 );
+    return data;
+}
+
+/* The 128 bits reversed, then shifted down by 128 - 82 */
+struct _hexin_crc82_value hexin_reverse82( struct _hexin_crc82_value data )
+{
+    struct _hexin_crc82_value result;
+    unsigned long long hi = hexin_reverse64( data.lo );
+    unsigned long long lo = hexin_reverse64( data.hi );
+
+    result.lo = ( lo >> ( 128 - HEXIN_CRC82_WIDTH ) ) | ( hi << ( HEXIN_CRC82_WIDTH - 64 ) );
+    result.hi = ( hi >> ( 128 - HEXIN_CRC82_WIDTH ) );
+    return result;
+}
+
+unsigned char hexin_crc82_init_table_poly_is_high( struct _hexin_crc82_value polynomial, struct _hexin_crc82_value *table )
+{
+    unsigned int i = 0, j = 0;
+    struct _hexin_crc82_value crc;
+
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc.lo = ( unsigned long long ) i;
+        crc.hi = 0;
+        for ( j=0; j<8; j++ ) {
+            if ( crc.lo & 0x0000000000000001ULL ) {
+                crc.lo = ( ( crc.lo >> 1 ) | ( crc.hi << 63 ) ) ^ polynomial.lo;
+                crc.hi = ( crc.hi >> 1 ) ^ polynomial.hi;
+            } else {
+                crc.lo = ( crc.lo >> 1 ) | ( crc.hi << 63 );
+                crc.hi = ( crc.hi >> 1 );
+            }
+        }
+        table[i] = crc;
+    }
+    return TRUE;
+}
+
+unsigned char hexin_crc82_init_table_poly_is_low( struct _hexin_crc82_value polynomial, struct _hexin_crc82_value *table )
+{
+    unsigned int i = 0, j = 0;
+    unsigned long long top = 0;
+    struct _hexin_crc82_value crc;
+
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc.lo = 0;
+        crc.hi = ( ( unsigned long long ) i ) << ( HEXIN_CRC82_WIDTH - 64 - 8 );
+        for ( j=0; j<8; j++ ) {
+            top    = crc.hi & ( ( HEXIN_CRC82_HI_MASK + 1 ) >> 1 );
+            crc.hi = ( ( crc.hi << 1 ) | ( crc.lo >> 63 ) ) & HEXIN_CRC82_HI_MASK;
+            crc.lo = ( crc.lo << 1 );
+            if ( top ) {
+                crc.lo ^= polynomial.lo;
+                crc.hi ^= polynomial.hi;
+            }
+        }
+        table[i] = crc;
+    }
+    return TRUE;
+}
+
+/*
+ * refin == FALSE : MSB-first table of param->poly, the register is in bits 0 .. 81.
+ * refin == TRUE  : LSB-first table of the reflected poly, the register is reflected.
+ */
+static unsigned int hexin_crc82_compute_init_table( struct _hexin_crc82 *param, struct _hexin_crc82_tables *tables )
+{
+    unsigned int i = 0, j = 0;
+    struct _hexin_crc82_value crc, entry;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        hexin_crc82_init_table_poly_is_high( hexin_reverse82( param->poly ), tables->table[0] );
+    } else {
+        hexin_crc82_init_table_poly_is_low( param->poly, tables->table[0] );
+    }
+
+    /* table[j][i] = CRC of byte i followed by j zero bytes ( slicing-by-8 ) */
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = tables->table[0][i];
+        for ( j=1; j<HEXIN_CRC82_SLICING; j++ ) {
+            if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+                entry  = tables->table[0][ crc.lo & 0xFF ];
+                crc.lo = ( ( crc.lo >> 8 ) | ( crc.hi << 56 ) ) ^ entry.lo;
+                crc.hi = ( crc.hi >> 8 ) ^ entry.hi;
+            } else {
+                entry  = tables->table[0][ ( crc.hi >> ( HEXIN_CRC82_WIDTH - 64 - 8 ) ) & 0xFF ];
+                crc.hi = ( ( ( crc.hi << 8 ) | ( crc.lo >> 56 ) ) & HEXIN_CRC82_HI_MASK ) ^ entry.hi;
+                crc.lo = ( crc.lo << 8 ) ^ entry.lo;
+            }
+            tables->table[j][i] = crc;
+        }
+    }
+    return TRUE;
+}
+
+unsigned int hexin_crc82_compute_init( struct _hexin_crc82 *param, struct _hexin_crc82_tables *tables )
+{
+    if ( param->is_initial == FALSE ) {
+        param->is_initial = hexin_crc82_compute_init_table( param, tables );
+    }
+    param->table      = ( const struct _hexin_crc82_value (*)[MAX_TABLE_ARRAY] )tables->table;
+    return param->is_initial;
+}
+
+/*
+ * compute() = final( update( start( init ) ) ), the register between them is the raw one
+ * ( reflected when refin ), the incremental hash objects keep it across update() calls.
+ */
+struct _hexin_crc82_value hexin_crc82_compute_start( const struct _hexin_crc82 *param, struct _hexin_crc82_value init, unsigned int is_gradual )
+{
+    struct _hexin_crc82_value crc = init;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        /* Fixed Issues #4 #8 : The reflected register of the gradual result is init itself. */
+        if ( !( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) ) ) {
+            crc = hexin_reverse82( init );
+        }
+    } else {
+        /* Fixed Issues #4 #8 */
+        if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( is_gradual ) ) ) {
+            crc = hexin_reverse82( init );
+        }
+    }
+    return crc;
+}
+
+/* The 8 bytes of s, the first one in bits 0 .. 7 ( LSB-first ) or in bits 56 .. 63 ( MSB-first ) */
+#define HEXIN_CRC82_LOAD_HIGH( s )  ( ( ( unsigned long long )s[0] <<  0 ) | ( ( unsigned long long )s[1] <<  8 ) |     \
+                                      ( ( unsigned long long )s[2] << 16 ) | ( ( unsigned long long )s[3] << 24 ) |     \
+                                      ( ( unsigned long long )s[4] << 32 ) | ( ( unsigned long long )s[5] << 40 ) |     \
+                                      ( ( unsigned long long )s[6] << 48 ) | ( ( unsigned long long )s[7] << 56 ) )
+#define HEXIN_CRC82_LOAD_LOW( s )   ( ( ( unsigned long long )s[0] << 56 ) | ( ( unsigned long long )s[1] << 48 ) |     \
+                                      ( ( unsigned long long )s[2] << 40 ) | ( ( unsigned long long )s[3] << 32 ) |     \
+                                      ( ( unsigned long long )s[4] << 24 ) | ( ( unsigned long long )s[5] << 16 ) |     \
+                                      ( ( unsigned long long )s[6] <<  8 ) | ( ( unsigned long long )s[7] <<  0 ) )
+
+/* x holds the 8 bytes to look up, the first one at bits 0 .. 7 of x ( LSB-first ) or at bits 56 .. 63 ( MSB-first ). */
+#define HEXIN_CRC82_SLICE( lo, hi, x, b, t )                                                                        \
+    do {                                                                                                            \
+        const struct _hexin_crc82_value *e0 = &t[7][ ( x >> b( 0 ) ) & 0xFF ], *e1 = &t[6][ ( x >> b( 1 ) ) & 0xFF ];    \
+        const struct _hexin_crc82_value *e2 = &t[5][ ( x >> b( 2 ) ) & 0xFF ], *e3 = &t[4][ ( x >> b( 3 ) ) & 0xFF ];    \
+        const struct _hexin_crc82_value *e4 = &t[3][ ( x >> b( 4 ) ) & 0xFF ], *e5 = &t[2][ ( x >> b( 5 ) ) & 0xFF ];    \
+        const struct _hexin_crc82_value *e6 = &t[1][ ( x >> b( 6 ) ) & 0xFF ], *e7 = &t[0][ ( x >> b( 7 ) ) & 0xFF ];    \
+        lo ^= e0->lo ^ e1->lo ^ e2->lo ^ e3->lo ^ e4->lo ^ e5->lo ^ e6->lo ^ e7->lo;                              \
+        hi ^= e0->hi ^ e1->hi ^ e2->hi ^ e3->hi ^ e4->hi ^ e5->hi ^ e6->hi ^ e7->hi;                              \
+    } while ( 0 )
+
+#define HEXIN_CRC82_SHIFT_HIGH( k ) ( 8 * ( k ) )
+#define HEXIN_CRC82_SHIFT_LOW( k )  ( 56 - 8 * ( k ) )
+
+/* Slicing-by-8, or the byte table only when LIBSCRC_KERNEL=scalar ( libscrc.kernel_for ). */
+unsigned int hexin_crc82_compute_kernel( const struct _hexin_crc82 *param )
+{
+    return ( hexin_cpu_features() & HEXIN_CPU_SLICING ) ? HEXIN_KERNEL_SLICING : HEXIN_KERNEL_SCALAR;
+}
+
+/*
+ * Slicing-by-8, 8 bytes move the 82-bit register by 64 bits :
+ * LSB-first : lo ^ bytes is looked up, hi drops into lo.
+ * MSB-first : bits 18 .. 81 ^ bytes are looked up, bits 0 .. 17 go up into hi.
+ */
+struct _hexin_crc82_value hexin_crc82_compute_update( const unsigned char *pSrc, size_t len, const struct _hexin_crc82 *param, struct _hexin_crc82_value crc82 )
+{
+    unsigned long long lo = crc82.lo, hi = crc82.hi, x = 0;
+    const struct _hexin_crc82_value (*t)[MAX_TABLE_ARRAY] = param->table;
+    const struct _hexin_crc82_value *entry = NULL;
+    size_t slicing = ( hexin_crc82_compute_kernel( param ) == HEXIN_KERNEL_SLICING ) ? HEXIN_CRC82_SLICING : ( size_t )-1;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        while ( len >= slicing ) {
+            x  = lo ^ HEXIN_CRC82_LOAD_HIGH( pSrc );
+            lo = hi;
+            hi = 0;
+            HEXIN_CRC82_SLICE( lo, hi, x, HEXIN_CRC82_SHIFT_HIGH, t );
+            pSrc += HEXIN_CRC82_SLICING;
+            len  -= HEXIN_CRC82_SLICING;
+        }
+        while ( len-- ) {
+            entry = &t[0][ ( lo ^ *pSrc++ ) & 0xFF ];
+            lo = ( ( lo >> 8 ) | ( hi << 56 ) ) ^ entry->lo;
+            hi = ( hi >> 8 ) ^ entry->hi;
+        }
+    } else {
+        while ( len >= slicing ) {
+            x  = ( ( hi << ( 128 - HEXIN_CRC82_WIDTH ) ) | ( lo >> ( HEXIN_CRC82_WIDTH - 64 ) ) ) ^ HEXIN_CRC82_LOAD_LOW( pSrc );
+            hi = lo & HEXIN_CRC82_HI_MASK;
+            lo = 0;
+            HEXIN_CRC82_SLICE( lo, hi, x, HEXIN_CRC82_SHIFT_LOW, t );
+            pSrc += HEXIN_CRC82_SLICING;
+            len  -= HEXIN_CRC82_SLICING;
+        }
+        while ( len-- ) {
+            entry = &t[0][ ( ( hi >> ( HEXIN_CRC82_WIDTH - 64 - 8 ) ) ^ *pSrc++ ) & 0xFF ];
+            hi = ( ( ( hi << 8 ) | ( lo >> 56 ) ) & HEXIN_CRC82_HI_MASK ) ^ entry->hi;
+            lo = ( lo << 8 ) ^ entry->lo;
+        }
+    }
+
+    crc82.lo = lo;
+    crc82.hi = hi;
+    return crc82;
+}
+
+struct _hexin_crc82_value hexin_crc82_compute_final( const struct _hexin_crc82 *param, struct _hexin_crc82_value crc82 )
+{
+    struct _hexin_crc82_value crc = crc82;
+
+    if ( HEXIN_REFIN_IS_TRUE( param ) != HEXIN_REFOUT_IS_TRUE( param ) ) {
+        crc = hexin_reverse82( crc );
+    }
+    crc.lo ^= param->xorout.lo;
+    crc.hi  = ( crc.hi ^ param->xorout.hi ) & HEXIN_CRC82_HI_MASK;
+    return crc;
+}
+
+struct _hexin_crc82_value hexin_crc82_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc82 *param, struct _hexin_crc82_value init, unsigned int is_gradual )
+{
+    struct _hexin_crc82_value crc = hexin_crc82_compute_start( param, init, is_gradual );
+
+    crc = hexin_crc82_compute_update( pSrc, len, param, crc );
+    return hexin_crc82_compute_final( param, crc );
+}
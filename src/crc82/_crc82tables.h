@@ -0,0 +1,81 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc82tables.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-09 [Heyn] Initialize ( was the bit loop of libscrc/_crc82.py ).
+*                       2022-06-13 [Heyn] New add hexin_crc82_compute_kernel().
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CRC82_TABLES_H__
+#define __CRC82_TABLES_H__
+
+#include <stddef.h>
+
+#ifndef TRUE
+#define                 TRUE                                    1
+#endif
+
+#ifndef FALSE
+#define                 FALSE                                   0
+#endif
+
+#ifndef MAX_TABLE_ARRAY
+#define                 MAX_TABLE_ARRAY                         256
+#endif
+
+#define                 HEXIN_CRC82_WIDTH                       82
+#define                 HEXIN_CRC82_HI_MASK                     0x000000000003FFFFULL       /* Bits 64 .. 81 */
+#define                 HEXIN_CRC82_SLICING                     8
+
+#define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
+#define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
+#define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
+
+#define                 CRC82_POLYNOMIAL_DARC_LO                0x0111011401440411ULL
+#define                 CRC82_POLYNOMIAL_DARC_HI                0x000000000000308CULL
+
+/* An 82-bit value, C has no portable 128-bit integer ( MSVC ). */
+struct _hexin_crc82_value {
+    unsigned long long  lo;                     /* Bits  0 .. 63 */
+    unsigned long long  hi;                     /* Bits 64 .. 81 */
+};
+
+struct _hexin_crc82 {
+    unsigned int  is_initial;
+    unsigned int  width;
+    struct _hexin_crc82_value  poly;
+    struct _hexin_crc82_value  init;
+    unsigned int  refin;
+    unsigned int  refout;
+    struct _hexin_crc82_value  xorout;
+    const struct _hexin_crc82_value (*table)[MAX_TABLE_ARRAY];     /* table[0] is the classic byte table */
+};
+
+/* Storage of the tables built at runtime ( hacker82 ), the built-in models use the generated ones. */
+struct _hexin_crc82_tables {
+    struct _hexin_crc82_value  table[HEXIN_CRC82_SLICING][MAX_TABLE_ARRAY];
+};
+
+
+struct _hexin_crc82_value hexin_reverse82( struct _hexin_crc82_value data );
+
+unsigned char hexin_crc82_init_table_poly_is_high( struct _hexin_crc82_value polynomial, struct _hexin_crc82_value *table );
+unsigned char hexin_crc82_init_table_poly_is_low(  struct _hexin_crc82_value polynomial, struct _hexin_crc82_value *table );
+
+unsigned int hexin_crc82_compute_init( struct _hexin_crc82 *param, struct _hexin_crc82_tables *tables );
+struct _hexin_crc82_value hexin_crc82_compute_start(  const struct _hexin_crc82 *param, struct _hexin_crc82_value init, unsigned int is_gradual );
+unsigned int              hexin_crc82_compute_kernel( const struct _hexin_crc82 *param );
+struct _hexin_crc82_value hexin_crc82_compute_update( const unsigned char *pSrc, size_t len, const struct _hexin_crc82 *param, struct _hexin_crc82_value crc );
+struct _hexin_crc82_value hexin_crc82_compute_final(  const struct _hexin_crc82 *param, struct _hexin_crc82_value crc );
+struct _hexin_crc82_value hexin_crc82_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc82 *param, struct _hexin_crc82_value init, unsigned int is_gradual );
+
+#endif //__CRC82_TABLES_H__
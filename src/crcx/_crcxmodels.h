@@ -0,0 +1,45 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crcxmodels.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize ( were the static const struct _hexin_crcx of _crcxmodule.c ).
+*                       The built-in models, one HEXIN_MODEL( param, width, poly, init, refin, refout, xorout ) per line.
+*                       Read by src/gentables.py for the tables ( _crcxgentables.h ) and by _crcxmodule.c for the descriptors,
+*                       the values are numbers.
+*
+*********************************************************************************************************
+*/
+
+/*           param                         width  poly    init    refin   refout  xorout */
+HEXIN_MODEL( crc3_param_gsm,               3,     0x0003, 0x0000, FALSE,  FALSE,  0x0007 )
+HEXIN_MODEL( crc3_param_rohc,              3,     0x0003, 0x0007, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc4_param_itu4,              4,     0x0003, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc4_param_interlaken,        4,     0x0003, 0x000F, FALSE,  FALSE,  0x000F )
+HEXIN_MODEL( crc5_param_itu5,              5,     0x0015, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc5_param_epc5,              5,     0x0009, 0x0009, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc5_param_usb5,              5,     0x0005, 0x001F, TRUE,   TRUE,   0x001F )
+HEXIN_MODEL( crc6_param_itu6,              6,     0x0003, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc6_param_gsm6,              6,     0x002F, 0x0000, FALSE,  FALSE,  0x003F )
+HEXIN_MODEL( crc6_param_darc,              6,     0x0019, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc7_param_mmc7,              7,     0x0009, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc7_param_umts,              7,     0x0045, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc7_param_rohc,              7,     0x004F, 0x007F, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc10_param_atm,              10,    0x0233, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc10_param_cdma2000,         10,    0x03D9, 0x03FF, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc10_param_gsm10,            10,    0x0175, 0x0000, FALSE,  FALSE,  0x03FF )
+HEXIN_MODEL( crc11_param_flexray,          11,    0x0385, 0x001A, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc11_param_umts11,           11,    0x0307, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc12_param_cdma2000,         12,    0x0F13, 0x0FFF, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc12_param_dect,             12,    0x080F, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc12_param_gsm,              12,    0x0D31, 0x0000, FALSE,  FALSE,  0x0FFF )
+HEXIN_MODEL( crc12_param_umts12,           12,    0x080F, 0x0000, FALSE,  TRUE,   0x0000 )
+HEXIN_MODEL( crc13_param_bbc,              13,    0x1CF5, 0x0000, FALSE,  FALSE,  0x0000 )
+HEXIN_MODEL( crc14_param_darc,             14,    0x0805, 0x0000, TRUE,   TRUE,   0x0000 )
+HEXIN_MODEL( crc14_param_gsm,              14,    0x202D, 0x0000, FALSE,  FALSE,  0x3FFF )
+HEXIN_MODEL( crc15_param_mpt1327,          15,    0x6815, 0x0000, FALSE,  FALSE,  0x0001 )
@@ -14,554 +14,409 @@
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Update gradually calculate functions.
 *                                         ( CRCx -> libscrc.umts12()  libscrc.crc12_3gpp() ).
+*                       2022-05-23 [Heyn] Release the GIL while computing large buffers.
+*                       2022-05-25 [Heyn] Model descriptors at file scope, tables built at import, per-call state on the stack.
+*                       2022-05-27 [Heyn] Built-in models use the tables generated by setup.py (src/gentables.py).
+*                       2022-05-28 [Heyn] Models with the same ( width, poly, reflected ) share one generated table.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-03 [Heyn] New add _batch(), many frames in one call with one GIL release (libscrc.batch).
+*                       2022-06-05 [Heyn] Model functions are METH_FASTCALL (METH_VARARGS before Python 3.7), no format string parsing.
+*                       2022-06-12 [Heyn] Built-in models get the CLMUL folding constants, batch() hashes frames in lockstep ( compute_multi ).
+*                       2022-06-13 [Heyn] New add _kernel(), the kernel of a model ( libscrc.kernel_for ), the CPU is probed at import.
+*                       2022-06-15 [Heyn] The built-in models are the HEXIN_MODEL() lines of _crcxmodels.h, setup.py build_ext generates the tables.
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] The new/combine/batch/kernel glue and the hash type of libscrc.new() are the ones of _hexin_module.h.
 *
 *********************************************************************************************************
 */
 
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "_crcxtables.h"
+#include "_crcxgentables.h"
+#include "_hexin_pool.h"
+#include "_hexin_fastcall.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+/* The built-in models ( _crcxmodels.h ), the tables are the ones generated by setup.py ( _crcxgentables.h ). */
+#define HEXIN_MODEL( param, width, poly, init, refin, refout, xorout )                                              \
+    static const struct _hexin_crcx param = { TRUE, width, poly, init, refin, refout, xorout, param##_table, &param##_clmul };
+#include "_crcxmodels.h"
+#undef HEXIN_MODEL
+
+/* Models of libscrc.new(), the names are the ones of the method table. */
+static const struct {
+    const char              *name;
+    const struct _hexin_crcx *param;
+} hexin_crcx_models[] = {
+    { "gsm3",           &crc3_param_gsm },
+    { "rohc3",          &crc3_param_rohc },
+    { "itu4",           &crc4_param_itu4 },
+    { "g_704",          &crc4_param_itu4 },
+    { "itu5",           &crc5_param_itu5 },
+    { "epc",            &crc5_param_epc5 },
+    { "usb5",           &crc5_param_usb5 },
+    { "itu6",           &crc6_param_itu6 },
+    { "gsm6",           &crc6_param_gsm6 },
+    { "darc6",          &crc6_param_darc },
+    { "mmc",            &crc7_param_mmc7 },
+    { "crc7",           &crc7_param_mmc7 },
+    { "umts7",          &crc7_param_umts },
+    { "rohc7",          &crc7_param_rohc },
+    { "atm10",          &crc10_param_atm },
+    { "gsm10",          &crc10_param_gsm10 },
+    { "umts11",         &crc11_param_umts11 },
+    { "dect12",         &crc12_param_dect },
+    { "gsm12",          &crc12_param_gsm },
+    { "umts12",         &crc12_param_umts12 },
+    { "crc12",          &crc12_param_dect },
+    { "bbc13",          &crc13_param_bbc },
+    { "darc14",         &crc14_param_darc },
+    { "gsm14",          &crc14_param_gsm },
+    { "crc12_3gpp",     &crc12_param_umts12 },
+    { "mpt1327",        &crc15_param_mpt1327 },
+    { "flexray11",      &crc11_param_flexray },
+    { "crc10_cdma2000", &crc10_param_cdma2000 },
+    { "crc12_cdma2000", &crc12_param_cdma2000 },
+    { "interlaken4",    &crc4_param_interlaken },
+    { NULL, NULL }
+};
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crcx *param )
-{
-    Py_buffer data = { NULL, NULL };
-    unsigned short init = param->init;
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
-
-    /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
-    if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
-        init = ( init ^ param->xorout );
-    }
-
-    param->result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+#define                 HEXIN_MODULE_NAME                       crcx
+#define                 HEXIN_MODULE_TYPE                       unsigned short
+#define                 HEXIN_MODULE_BITS                       16
+#define                 HEXIN_MODULE_TITLE                      "CRCX"
+#include "_hexin_module.h"
 
-    return TRUE;
-}
-
-static PyObject * _crc3_gsm( PyObject *self, PyObject *args )
+static PyObject * _crc3_gsm( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc3_param_gsm = { .is_initial=FALSE,
-                                                 .width  = 3,
-                                                 .poly   = 0x03,
-                                                 .init   = 0x00,
-                                                 .refin  = FALSE,
-                                                 .refout = FALSE,
-                                                 .xorout = 0x07,
-                                                 .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_gsm ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc3_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_gsm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc3_rohc( PyObject *self, PyObject *args )
+static PyObject * _crc3_rohc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc3_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 3,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x07,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_rohc ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc3_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_rohc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc4_itu( PyObject *self, PyObject *args )
+static PyObject * _crc4_itu( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc4_param_itu4 = { .is_initial=FALSE,
-                                                  .width  = 4,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_itu4 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc4_param_itu4, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_itu4.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc4_interlaken4( PyObject *self, PyObject *args )
+static PyObject * _crc4_interlaken4( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc4_param_interlaken = { .is_initial=FALSE,
-                                                        .width  = 4,
-                                                        .poly   = 0x03,
-                                                        .init   = 0x0F,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x0F,
-                                                        .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_interlaken ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc4_param_interlaken, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_interlaken.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc5_itu( PyObject *self, PyObject *args )
+static PyObject * _crc5_itu( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc5_param_itu5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x15,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_itu5 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc5_param_itu5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_itu5.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc5_epc( PyObject *self, PyObject *args )
+static PyObject * _crc5_epc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc5_param_epc5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x09,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_epc5 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc5_param_epc5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_epc5.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc5_usb( PyObject *self, PyObject *args )
+static PyObject * _crc5_usb( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc5_param_usb5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x05,
-                                                  .init   = 0x1F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x1F,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_usb5 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc5_param_usb5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_usb5.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc6_itu( PyObject *self, PyObject *args )
+static PyObject * _crc6_itu( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc6_param_itu6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_itu6 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc6_param_itu6, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_itu6.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc6_gsm( PyObject *self, PyObject *args )
+static PyObject * _crc6_gsm( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc6_param_gsm6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x2F,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x3F,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_gsm6 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc6_param_gsm6, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_gsm6.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc6_darc6( PyObject *self, PyObject *args )
+static PyObject * _crc6_darc6( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc6_param_darc = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x19,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_darc ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc6_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_darc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc7_mmc( PyObject *self, PyObject *args )
+static PyObject * _crc7_mmc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc7_param_mmc7 = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_mmc7 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc7_param_mmc7, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_mmc7.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc7_umts7( PyObject *self, PyObject *args )
+static PyObject * _crc7_umts7( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc7_param_umts = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x45,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_umts ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc7_param_umts, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_umts.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc7_rohc7( PyObject *self, PyObject *args )
+static PyObject * _crc7_rohc7( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc7_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x4F,
-                                                  .init   = 0x7F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_rohc ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc7_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_rohc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc10_atm10( PyObject *self, PyObject *args )
+static PyObject * _crc10_atm10( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc10_param_atm = { .is_initial=FALSE,
-                                                  .width  = 10,
-                                                  .poly   = 0x233,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x000,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_atm ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc10_param_atm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_atm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc10_cdma2000( PyObject *self, PyObject *args )
+static PyObject * _crc10_cdma2000( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc10_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 10,
-                                                       .poly   = 0x3D9,
-                                                       .init   = 0x3FF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_cdma2000 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc10_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_cdma2000.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc10_gsm10( PyObject *self, PyObject *args )
+static PyObject * _crc10_gsm10( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc10_param_gsm10 = { .is_initial=FALSE,
-                                                    .width  = 10,
-                                                    .poly   = 0x175,
-                                                    .init   = 0x000,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FF,
-                                                    .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_gsm10 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc10_param_gsm10, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_gsm10.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc11_flexray11( PyObject *self, PyObject *args )
+static PyObject * _crc11_flexray11( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc11_param_flexray = { .is_initial=FALSE,
-                                                      .width  = 11,
-                                                      .poly   = 0x385,
-                                                      .init   = 0x01A,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x000,
-                                                      .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_flexray ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc11_param_flexray, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_flexray.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc11_umts11( PyObject *self, PyObject *args )
+static PyObject * _crc11_umts11( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc11_param_umts11 = { .is_initial=FALSE,
-                                                     .width  = 11,
-                                                     .poly   = 0x307,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_umts11 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc11_param_umts11, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_umts11.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc12_cdma2000( PyObject *self, PyObject *args )
+static PyObject * _crc12_cdma2000( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc12_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 12,
-                                                       .poly   = 0xF13,
-                                                       .init   = 0xFFF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_cdma2000 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc12_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_cdma2000.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc12_dect12( PyObject *self, PyObject *args )
+static PyObject * _crc12_dect12( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc12_param_dect = { .is_initial=FALSE,
-                                                   .width  = 12,
-                                                   .poly   = 0x80F,
-                                                   .init   = 0x000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x000,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_dect ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc12_param_dect, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_dect.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc12_gsm12( PyObject *self, PyObject *args )
+static PyObject * _crc12_gsm12( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc12_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 12,
-                                                  .poly   = 0xD31,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFF,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_gsm ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc12_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_gsm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc12_umts12( PyObject *self, PyObject *args )
+static PyObject * _crc12_umts12( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc12_param_umts12 = { .is_initial=FALSE,
-                                                     .width  = 12,
-                                                     .poly   = 0x80F,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_umts12 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc12_param_umts12, &result ) ) {
         return NULL;
     }
 
     /* TODO : refin=False, refout=True
        v1.7 fixed ( removed below code )
     */
-    // crc12_param_umts12.result = hexin_crcx_reverse12( crc12_param_umts12.result );
+    // result = hexin_crcx_reverse12( result );
 
-    return Py_BuildValue( "H", crc12_param_umts12.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc13_bbc( PyObject *self, PyObject *args )
+static PyObject * _crc13_bbc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc13_param_bbc = { .is_initial=FALSE,
-                                                  .width  = 13,
-                                                  .poly   = 0x1CF5,
-                                                  .init   = 0x0000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x0000,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc13_param_bbc ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc13_param_bbc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc13_param_bbc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc14_darc( PyObject *self, PyObject *args )
+static PyObject * _crc14_darc( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc14_param_darc = { .is_initial=FALSE,
-                                                   .width  = 14,
-                                                   .poly   = 0x0805,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_darc ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc14_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_darc.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc14_gsm( PyObject *self, PyObject *args )
+static PyObject * _crc14_gsm( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc14_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 14,
-                                                  .poly   = 0x202D,
-                                                  .init   = 0x0000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x3FFF,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_gsm ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc14_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_gsm.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
-static PyObject * _crc15_mpt1327( PyObject *self, PyObject *args )
+static PyObject * _crc15_mpt1327( PyObject *self, HEXIN_FASTCALL_ARGS )
 {
-    static struct _hexin_crcx crc15_param_mpt1327 = { .is_initial=FALSE,
-                                                      .width  = 15,
-                                                      .poly   = 0x6815,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0001,
-                                                      .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc15_param_mpt1327 ) ) {
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_PASS, &crc15_param_mpt1327, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc15_param_mpt1327.result );
+    return hexin_PyLong_FromUnsigned( result );
 }
 
 /* method table */
 static PyMethodDef _crcxMethods[] = {
-    { "gsm3",    _crc3_gsm,          METH_VARARGS, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
-    { "rohc3",   _crc3_rohc,         METH_VARARGS, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu4",    _crc4_itu,          METH_VARARGS, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "g_704",   _crc4_itu,          METH_VARARGS, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu5",    _crc5_itu,          METH_VARARGS, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "epc",     _crc5_epc,          METH_VARARGS, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
-    { "usb5",    _crc5_usb,          METH_VARARGS, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
-    { "itu6",    _crc6_itu,          METH_VARARGS, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "gsm6",    _crc6_gsm,          METH_VARARGS, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
-    { "darc6",   _crc6_darc6,        METH_VARARGS, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
-    { "mmc",     _crc7_mmc,          METH_VARARGS, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "crc7",    _crc7_mmc,          METH_VARARGS, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "umts7",   _crc7_umts7,        METH_VARARGS, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "rohc7",   _crc7_rohc7,        METH_VARARGS, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
-    { "atm10",   _crc10_atm10,       METH_VARARGS, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm10",   _crc10_gsm10,       METH_VARARGS, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
-    { "umts11",  _crc11_umts11,      METH_VARARGS, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "dect12",  _crc12_dect12,      METH_VARARGS, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm12",   _crc12_gsm12,       METH_VARARGS, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
-    { "umts12",  _crc12_umts12,      METH_VARARGS, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "crc12",   _crc12_dect12,      METH_VARARGS, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "bbc13",   _crc13_bbc,         METH_VARARGS, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
-    { "darc14",  _crc14_darc,        METH_VARARGS, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
-    { "gsm14",   _crc14_gsm,         METH_VARARGS, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
+    { "gsm3",    (PyCFunction)_crc3_gsm,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
+    { "rohc3",   (PyCFunction)_crc3_rohc,                   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu4",    (PyCFunction)_crc4_itu,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "g_704",   (PyCFunction)_crc4_itu,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu5",    (PyCFunction)_crc5_itu,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "epc",     (PyCFunction)_crc5_epc,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
+    { "usb5",    (PyCFunction)_crc5_usb,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
+    { "itu6",    (PyCFunction)_crc6_itu,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "gsm6",    (PyCFunction)_crc6_gsm,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
+    { "darc6",   (PyCFunction)_crc6_darc6,                  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
+    { "mmc",     (PyCFunction)_crc7_mmc,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "crc7",    (PyCFunction)_crc7_mmc,                    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "umts7",   (PyCFunction)_crc7_umts7,                  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "rohc7",   (PyCFunction)_crc7_rohc7,                  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
+    { "atm10",   (PyCFunction)_crc10_atm10,                 HEXIN_METH_FASTCALL_KEYWORDS, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm10",   (PyCFunction)_crc10_gsm10,                 HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
+    { "umts11",  (PyCFunction)_crc11_umts11,                HEXIN_METH_FASTCALL_KEYWORDS, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "dect12",  (PyCFunction)_crc12_dect12,                HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm12",   (PyCFunction)_crc12_gsm12,                 HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
+    { "umts12",  (PyCFunction)_crc12_umts12,                HEXIN_METH_FASTCALL_KEYWORDS, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "crc12",   (PyCFunction)_crc12_dect12,                HEXIN_METH_FASTCALL_KEYWORDS, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "bbc13",   (PyCFunction)_crc13_bbc,                   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
+    { "darc14",  (PyCFunction)_crc14_darc,                  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
+    { "gsm14",   (PyCFunction)_crc14_gsm,                   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
     
-    { "crc12_3gpp",         _crc12_umts12,      METH_VARARGS, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "mpt1327",            _crc15_mpt1327,     METH_VARARGS, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
-    { "flexray11",          _crc11_flexray11,   METH_VARARGS, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
-    { "crc10_cdma2000",     _crc10_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
-    { "crc12_cdma2000",     _crc12_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
-    { "interlaken4",        _crc4_interlaken4,  METH_VARARGS, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    { "crc12_3gpp",         (PyCFunction)_crc12_umts12,     HEXIN_METH_FASTCALL_KEYWORDS, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "mpt1327",            (PyCFunction)_crc15_mpt1327,    HEXIN_METH_FASTCALL_KEYWORDS, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
+    { "flexray11",          (PyCFunction)_crc11_flexray11,  HEXIN_METH_FASTCALL_KEYWORDS, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
+    { "crc10_cdma2000",     (PyCFunction)_crc10_cdma2000,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
+    { "crc12_cdma2000",     (PyCFunction)_crc12_cdma2000,   HEXIN_METH_FASTCALL_KEYWORDS, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
+    { "interlaken4",        (PyCFunction)_crc4_interlaken4, HEXIN_METH_FASTCALL_KEYWORDS, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    HEXIN_MODULE_METHODS,
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -603,6 +458,18 @@ PyInit__crcx( void )
 {
     PyObject *m = NULL;
 
+    if ( hexin_crcx_hash_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crcx_compute() may run without the GIL. */
+    hexin_cpu_features();
+
+    /* The worker pool of threads=N is the one of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
     m = PyModule_Create( &_crcxmodule );
     if ( m == NULL ) {
         return NULL;
@@ -620,6 +487,14 @@ PyInit__crcx( void )
 PyMODINIT_FUNC
 init_crcx( void )
 {
+    if ( hexin_crcx_hash_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import ( CPUID, LIBSCRC_KERNEL ), hexin_crcx_compute() may run without the GIL. */
+    hexin_cpu_features();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
     (void) Py_InitModule3( "_crcx", _crcxMethods, _crcx_doc );
 }
 
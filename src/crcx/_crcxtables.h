@@ -13,6 +13,14 @@
 *                       2020-04-27 [Heyn] Optimized code.
 *                       2020-08-04 [Heyn] Fixed Issues #4.
 *                       2021-06-07 [Heyn] Fixed Issues #8.
+*                       2022-05-23 [Heyn] New add compute_init(), is_gradual is a per-call argument.
+*                       2022-05-25 [Heyn] compute() takes a const descriptor, poly is no longer shifted in place.
+*                       2022-05-27 [Heyn] Table pointer in the descriptor, compute_init() builds into the caller's storage.
+*                       2022-05-30 [Heyn] Split hexin_xxx_compute() into compute_start/update/final(), incremental objects ( libscrc.new ).
+*                       2022-05-31 [Heyn] New add combine(), CRC of A + B from CRC( A ), CRC( B ) and len( B ).
+*                       2022-06-01 [Heyn] New add threads=N and chunk=N, large buffers are hashed in parts on a worker pool.
+*                       2022-06-02 [Heyn] size_t lengths, buffers over 4 GiB are no longer truncated (PY_SSIZE_T_CLEAN).
+*                       2022-06-12 [Heyn] Engine structs and prototypes from _hexin_core.h ( HEXIN_CORE_NAME / TYPE / BITS ).
 *
 *********************************************************************************************************
 */
@@ -20,6 +28,8 @@
 #ifndef __CRCX_TABLES_H__
 #define __CRCX_TABLES_H__
 
+#include <stddef.h>
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -36,22 +46,12 @@
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
-#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
-
-struct _hexin_crcx {
-    unsigned int    is_initial;
-    unsigned int    is_gradual;
-    unsigned short  width;
-    unsigned short  poly;
-    unsigned short  init;
-    unsigned int    refin;
-    unsigned int    refout;
-    unsigned short  xorout;
-    unsigned short  result;
-    unsigned short  table[MAX_TABLE_ARRAY];
-};
-
-unsigned short hexin_crcx_reverse12( unsigned short data );
-unsigned short hexin_crcx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crcx *param, unsigned short init );
+#define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( (x) == 2 )
+
+/* The engine, see _hexin_core.h */
+#define                 HEXIN_CORE_NAME                         crcx
+#define                 HEXIN_CORE_TYPE                         unsigned short
+#define                 HEXIN_CORE_BITS                         16
+#include "_hexin_core.h"
 
 #endif //__CRCX_TABLES_H__
@@ -0,0 +1,263 @@
+# -*- coding:utf-8 -*-
+""" Generate the static const tables of the built-in CRC models. """
+from __future__ import unicode_literals
+import re
+import sys
+from os import path, makedirs
+from io import open
+
+# !/usr/bin/python
+# Python:   2.7/3.4+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Called by setup.py build_ext, writes <build_temp>/gentables/_<module>gentables.h
+#           The built-in models ( HEXIN_MODEL() lines of src/<module>/_<module>models.h ) point at these tables,
+#           so they live in .rodata and nothing is built at import or on the first call.
+#           hacker*() models are built at runtime and are skipped.
+# History:  2022-05-27 [Heyn] Initialize.
+#           2022-05-28 [Heyn] One table per ( width, poly, reflected ), shared by the models.
+#           2022-06-09 [Heyn] New add crc82, the values are { lo, hi } pairs of 64 bits.
+#           2022-06-12 [Heyn] One engine for every module ( src/common/_hexin_core.h ), slicing-by-8 rows and clmul constants for all.
+#           2022-06-14 [Heyn] New add fold2048 to the clmul constants ( AVX-512 VPCLMULQDQ kernel ).
+#           2022-06-15 [Heyn] Read the models from _<module>models.h ( shared with the C code ), no more regex over the C sources.
+#                             Writes into the build directory, src/ is left alone.
+
+# module : ( C type, bits of the register, slicing rows ( macro ), clmul folding constants )
+MODULES = {
+    'crcx'  : ( 'unsigned short',     16, 'HEXIN_CORE_SLICING', True ),
+    'canx'  : ( 'unsigned int',       32, 'HEXIN_CORE_SLICING', True ),
+    'crc8'  : ( 'unsigned char',       8, 'HEXIN_CORE_SLICING', True ),
+    'crc16' : ( 'unsigned short',     16, 'HEXIN_CORE_SLICING', True ),
+    'crc24' : ( 'unsigned int',       32, 'HEXIN_CORE_SLICING', True ),
+    'crc32' : ( 'unsigned int',       32, 'HEXIN_CORE_SLICING', True ),
+    'crc64' : ( 'unsigned long long', 64, 'HEXIN_CORE_SLICING', True ),
+    'crc82' : ( 'struct _hexin_crc82_value', 82, 'HEXIN_CRC82_SLICING', False ),
+}
+
+SLICING = 8
+
+HEADER = '''/*
+*********************************************************************************************************
+*   Generated by setup.py build_ext ( src/gentables.py ) from {source}, DO NOT EDIT.
+*********************************************************************************************************
+*/
+
+#ifndef __{guard}_GENTABLES_H__
+#define __{guard}_GENTABLES_H__
+
+'''
+
+FOOTER = '''
+#endif //__{guard}_GENTABLES_H__
+'''
+
+RE_COMMENT = re.compile( r'/\*.*?\*/', re.S )
+RE_VALUE82 = re.compile( r'HEXIN_CRC82_VALUE\(\s*(\w+)\s*,\s*(\w+)\s*\)' )
+RE_MODEL   = re.compile( r'^HEXIN_MODEL\(\s*(\w+)\s*,([^()]*)\)$' )
+FIELDS     = ( 'width', 'poly', 'init', 'refin', 'refout', 'xorout' )
+
+
+def _mask( bits ):
+    return ( 1 << bits ) - 1
+
+
+def _reflect( data, bits ):
+    return int( '{0:0{1}b}'.format( data & _mask( bits ), bits )[::-1], 2 )
+
+
+def _table_lsb( poly, bits ):
+    """ LSB first ( reflected ) byte table, poly is already reflected. """
+    table = []
+    for i in range( 256 ):
+        crc = i
+        for _ in range( 8 ):
+            crc = ( crc >> 1 ) ^ poly if ( crc & 1 ) else ( crc >> 1 )
+        table.append( crc & _mask( bits ) )
+    return table
+
+
+def _table_msb( poly, bits, top ):
+    """ MSB first byte table, top is the bit tested ( bits - 1, except crc24 which runs in 32 bits ). """
+    table = []
+    for i in range( 256 ):
+        crc, c = 0, i << ( top - 7 )
+        for _ in range( 8 ):
+            crc = ( ( crc << 1 ) ^ poly ) if ( ( crc ^ c ) & ( 1 << top ) ) else ( crc << 1 )
+            crc, c = crc & _mask( bits ), c << 1
+        table.append( crc )
+    return table
+
+
+def _table_slicing( table, bits, reflected, rows ):
+    """ table[j][i] = CRC of byte i followed by j zero bytes. """
+    slicing = [ table ] + [ [ 0 ] * 256 for _ in range( rows - 1 ) ]
+    for i in range( 256 ):
+        crc = table[i]
+        for j in range( 1, rows ):
+            if reflected:
+                crc = ( crc >> 8 ) ^ table[ crc & 0xFF ]
+            else:
+                crc = ( ( crc << 8 ) & _mask( bits ) ) ^ table[ crc >> ( bits - 8 ) ]
+            slicing[j][i] = crc
+    return slicing
+
+
+def _xpow_mod( n, poly ):
+    """ x^n mod P, P(x) = x^64 + poly. Same as _hexin_clmul.c """
+    r = 1
+    for _ in range( n ):
+        r = ( ( r << 1 ) ^ poly ) if ( r >> 63 ) else ( r << 1 )
+        r &= _mask( 64 )
+    return r
+
+
+def _barrett_mu( poly ):
+    r, q = poly, 0
+    for _ in range( 64 ):
+        q <<= 1
+        if r >> 63:
+            q |= 1
+            r = ( ( r << 1 ) ^ poly ) & _mask( 64 )
+        else:
+            r = ( r << 1 ) & _mask( 64 )
+    return q
+
+
+def _clmul( poly, reflected ):
+    """ struct _hexin_clmul { reflected, poly, fold2048[2], fold512[2], fold128[2], barrett[2] } """
+    fold = []
+    for n in ( 2048, 512, 128 ):
+        if reflected:
+            fold.append( ( _reflect( _xpow_mod( n + 64 - 1, poly ), 64 ), _reflect( _xpow_mod( n - 1, poly ), 64 ) ) )
+        else:
+            fold.append( ( _xpow_mod( n, poly ), _xpow_mod( n + 64, poly ) ) )
+    mu = _barrett_mu( poly )
+    barrett = ( _reflect( mu, 64 ), _reflect( poly, 64 ) ) if reflected else ( mu, poly )
+    return ( reflected, poly, fold[0], fold[1], fold[2], barrett )
+
+
+def _value( text ):
+    text = text.strip()
+    if text.startswith( '{' ):
+        lo, hi = text.strip( '{}' ).split()
+        return _value( lo ) | ( _value( hi ) << 64 )
+    if text in ( 'TRUE', 'FALSE' ):
+        return 1 if text == 'TRUE' else 0
+    return int( text.rstrip( 'uUlL' ), 0 )
+
+
+def _models( source ):
+    """ [ ( param, { width, poly, init, refin, refout, xorout } ) ] of a _<module>models.h """
+    with open( source, encoding='utf-8' ) as f:
+        # Keep the line numbers of the errors, a comment becomes its newlines.
+        text = RE_COMMENT.sub( lambda m: '\n' * m.group( 0 ).count( '\n' ), f.read() )
+
+    models = []
+    for number, line in enumerate( text.splitlines(), 1 ):
+        line = RE_VALUE82.sub( r'{\1 \2}', line.strip() )
+        if not line:
+            continue
+        match  = RE_MODEL.match( line )
+        values = match.group( 2 ).split( ',' ) if match else []
+        if len( values ) != len( FIELDS ):
+            raise ValueError( '{0}:{1}: expected HEXIN_MODEL( param, {2} )'.format( source, number, ', '.join( FIELDS ) ) )
+        try:
+            models.append( ( match.group( 1 ), dict( zip( FIELDS, [ _value( v ) for v in values ] ) ) ) )
+        except ValueError:
+            raise ValueError( '{0}:{1}: the values must be numbers, TRUE or FALSE'.format( source, number ) )
+    return models
+
+
+def _tables( module, param ):
+    """ Mirrors hexin_<module>_compute_init_table(), returns ( reflected, tables, clmul constants ) """
+    ctype, bits, rows, clmul = MODULES[module]
+    width, poly, refin = param['width'], param['poly'], param['refin']
+
+    # A narrower CRC runs in the register with poly aligned to the top bit ( _hexin_coreimpl.h )
+    aligned = ( poly << ( bits - width ) ) & _mask( bits )
+
+    table = _table_lsb( _reflect( aligned, bits ), bits ) if refin else _table_msb( aligned, bits, bits - 1 )
+    slicing = _table_slicing( table, bits, refin, SLICING )
+    if clmul:
+        return refin, slicing, _clmul( aligned << ( 64 - bits ), refin )
+    return refin, slicing, None
+
+
+def _symbol( module, kind, param, reflected ):
+    """ Registry key ( width, poly, reflected ) -> crc16_table_16_1021, crc16_table_16_8005_ref, crc32_clmul_32_04C11DB7_ref """
+    return '{0}_{1}_{2}_{3:0{4}X}{5}'.format( module, kind, param['width'], param['poly'], min( 4, ( param['width'] + 3 ) // 4 ),
+                                             '_ref' if reflected else '' )
+
+
+def _format_table( table, digits, suffix, indent ):
+    if digits > 16:
+        items = [ '{{ 0x{0:016X}ULL, 0x{1:016X}ULL }}'.format( v & _mask( 64 ), v >> 64 ) for v in table ]
+        return ',\n'.join( indent + ', '.join( items[i:i + 2] ) for i in range( 0, len( items ), 2 ) )
+    per_line = 8 if digits <= 8 else 4
+    lines = []
+    for i in range( 0, len( table ), per_line ):
+        items = [ '0x{0:0{1}X}{2}'.format( v, digits, suffix ) for v in table[i:i + per_line] ]
+        lines.append( indent + ', '.join( items ) )
+    return ',\n'.join( lines )
+
+
+def _format_clmul( clmul ):
+    reflected, poly, fold2048, fold512, fold128, barrett = clmul
+    pair = lambda p: '{{ 0x{0:016X}ULL, 0x{1:016X}ULL }}'.format( *p )
+    return '{{ {0}, 0x{1:016X}ULL, {2}, {3}, {4}, {5} }}'.format( 'TRUE' if reflected else 'FALSE', poly, pair( fold2048 ),
+                                                                 pair( fold512 ), pair( fold128 ), pair( barrett ) )
+
+
+def generate_module( srcdir, outdir, module ):
+    ctype, bits, rows, clmul = MODULES[module]
+    source = path.join( srcdir, module, '_{0}models.h'.format( module ) )
+    output = path.join( outdir, '_{0}gentables.h'.format( module ) )
+
+    digits = bits // 4
+    suffix = 'ULL' if bits == 64 else ( 'L' if bits == 32 else '' )
+    # Models differing only in init / xorout share one table ( and one set of folding constants ),
+    # <param>_table and <param>_clmul are what the HEXIN_MODEL() of _<module>module.c points at.
+    body, alias, registry = [], [], set()
+    for name, param in _models( source ):
+        reflected, slicing, constants = _tables( module, param )
+        tname = _symbol( module, 'table', param, reflected )
+        cname = _symbol( module, 'clmul', param, reflected )
+
+        alias.append( '#define {0:<40} {1}\n'.format( name + '_table', tname ) )
+        if constants is not None:
+            alias.append( '#define {0:<40} {1}\n'.format( name + '_clmul', cname ) )
+
+        if tname in registry:
+            continue
+        registry.add( tname )
+
+        rows_text = [ '    {\n' + _format_table( t, digits, suffix, '        ' ) + '\n    }' for t in slicing ]
+        body.append( 'static const {0} {1}[{2}][MAX_TABLE_ARRAY] = {{\n{3}\n}};\n'.format(
+                     ctype, tname, rows, ',\n'.join( rows_text ) ) )
+        if constants is not None:
+            body.append( 'static const struct _hexin_clmul {0} = {1};\n'.format( cname, _format_clmul( constants ) ) )
+
+    guard = module.upper()
+    content = HEADER.format( source=path.basename( source ), guard=guard ) + '\n'.join( body ) + '\n' + ''.join( alias ) + \
+              FOOTER.format( guard=guard )
+
+    # Do not touch an up to date header, the extension would be rebuilt for nothing.
+    if path.exists( output ):
+        with open( output, encoding='utf-8' ) as f:
+            if f.read() == content:
+                return output
+    with open( output, 'w', encoding='utf-8', newline='\n' ) as f:
+        f.write( content )
+    return output
+
+
+def generate( srcdir, outdir ):
+    if not path.isdir( outdir ):
+        makedirs( outdir )
+    return [ generate_module( srcdir, outdir, module ) for module in sorted( MODULES ) ]
+
+
+if __name__ == '__main__':
+    # python src/gentables.py <outdir>, setup.py build_ext does the same into its build_temp.
+    for name in generate( path.dirname( path.abspath( __file__ ) ), sys.argv[1] if len( sys.argv ) > 1 else '.' ):
+        print( name )
@@ -0,0 +1,698 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _modelmodule.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-11 [Heyn] Initialize.
+*                       libscrc.Model( width, poly, init, refin, refout, xorout ), a CRC model compiled once :
+*                       the engine, its kernel and its tables are chosen and built by the constructor.
+*                       2022-06-12 [Heyn] batch() of the 33 .. 64 bits models hashes frames in lockstep ( compute_multi ).
+*                       2022-06-15 [Heyn] The worker pool is the one of libscrc._pool ( one per process ), imported at init.
+*                       2022-06-15 [Heyn] new(), combine() and batch() are METH_FASTCALL ( hexin_fastcall_parse() ), no format strings.
+*                       2022-06-15 [Heyn] The hash objects have a lock, update() of two threads no longer loses one of them.
+*                       2022-06-15 [Heyn] Model.kernel is hexin_xxx_compute_kernel() ( names of libscrc.KERNELS ), as libscrc.kernel_for().
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <structmember.h>
+#include "_crc32tables.h"
+#undef HEXIN_POLYNOMIAL_IS_HIGH                 /* Defined again ( 64 bits ) by _crc64tables.h, not used here */
+#include "_crc64tables.h"
+#include "_hexin_batch.h"
+#include "_hexin_fastcall.h"
+#include "_hexin_lock.h"
+#include "_hexin_pool.h"
+
+#define                 HEXIN_GIL_RELEASE_MINSIZE               ( 5 * 1024 )        /* Same as zlib.crc32() */
+
+#define                 HEXIN_MODEL_MIN_WIDTH                   3
+#define                 HEXIN_MODEL_MAX_WIDTH                   64
+
+/* Engine of a model : widths 3 .. 32 on the _crc32 one ( slicing-by-8, CLMUL ), 33 .. 64 on the _crc64 one ( CLMUL ). */
+#define                 HEXIN_MODEL_ENGINE_CRC32                0
+#define                 HEXIN_MODEL_ENGINE_CRC64                1
+
+/*
+ * The descriptor of the engine points at the tables, they are built by the constructor and never change after :
+ * the model, and its incremental objects, compute without the GIL and without a copy of them.
+ */
+typedef struct {
+    PyObject_HEAD
+#if PY_VERSION_HEX >= 0x03090000
+    vectorcallfunc                      vectorcall;
+#endif /* PY_VERSION_HEX */
+    unsigned int                        engine;
+    unsigned int                        width;
+    unsigned long long                  poly;
+    unsigned long long                  init;
+    unsigned long long                  xorout;
+    unsigned int                        refin;
+    unsigned int                        refout;
+    const char                         *kernel;
+    union {
+        struct _hexin_crc32             crc32;
+        struct _hexin_crc64             crc64;
+    } param;
+    union {
+        struct _hexin_crc32_tables      crc32;
+        struct _hexin_crc64_tables      crc64;
+    } *tables;
+    union {
+        struct _hexin_crc32_combine     crc32;
+        struct _hexin_crc64_combine     crc64;
+    } *combine;                                 /* Built by the first combine() */
+} hexin_model;
+
+static PyTypeObject hexin_model_type = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+static PyObject *hexin_model_array = NULL;      /* array.array, results of batch() */
+
+static unsigned long long hexin_model_mask( const hexin_model *self )
+{
+    return ( unsigned long long )( ~( unsigned long long )0 ) >> ( 64 - self->width );
+}
+
+static unsigned long long hexin_model_start( const hexin_model *self )
+{
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        return hexin_crc32_compute_start( &self->param.crc32, self->param.crc32.init, FALSE );
+    }
+    return hexin_crc64_compute_start( &self->param.crc64, self->param.crc64.init, FALSE );
+}
+
+static unsigned long long hexin_model_update( const hexin_model *self, const unsigned char *pSrc, size_t len, unsigned long long crc )
+{
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        return hexin_crc32_compute_update( pSrc, len, &self->param.crc32, ( unsigned int )crc );
+    }
+    return hexin_crc64_compute_update( pSrc, len, &self->param.crc64, crc );
+}
+
+static unsigned long long hexin_model_final( const hexin_model *self, unsigned long long crc )
+{
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        return hexin_crc32_compute_final( &self->param.crc32, ( unsigned int )crc ) & hexin_model_mask( self );
+    }
+    return hexin_crc64_compute_final( &self->param.crc64, crc ) & hexin_model_mask( self );
+}
+
+static unsigned long long hexin_model_compute( const hexin_model *self, const unsigned char *pSrc, size_t len )
+{
+    return hexin_model_final( self, hexin_model_update( self, pSrc, len, hexin_model_start( self ) ) );
+}
+
+/* The CRC of the bytes of data, with the GIL released for the large ones. */
+static PyObject * hexin_model_compute_object( hexin_model *self, PyObject *object )
+{
+    Py_buffer data = { NULL, NULL };
+    unsigned long long result = 0;
+
+    if ( !hexin_fastcall_buffer( object, &data ) ) {
+        return NULL;
+    }
+
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_model_compute( self, (const unsigned char *)data.buf, (size_t)data.len );
+        Py_END_ALLOW_THREADS
+    } else {
+        result = hexin_model_compute( self, (const unsigned char *)data.buf, (size_t)data.len );
+    }
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static const char* hexin_model_call_kwlist[]={ "data", NULL };
+
+#if PY_VERSION_HEX >= 0x03090000
+/* model( data ), the arguments are not packed in a tuple ( vectorcall ). */
+static PyObject * hexin_model_vectorcall( PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames )
+{
+    PyObject *values[1];
+
+    if ( hexin_fastcall_parse( args, PyVectorcall_NARGS( nargsf ), kwnames, hexin_model_call_kwlist, 1, values ) < 0 ) {
+        return NULL;
+    }
+    return hexin_model_compute_object( ( hexin_model * )self, values[0] );
+}
+#else
+static PyObject * hexin_model_call( hexin_model *self, PyObject *args, PyObject *kws )
+{
+    PyObject *data = NULL;
+
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "O", ( char ** )hexin_model_call_kwlist, &data ) ) {
+        return NULL;
+    }
+    return hexin_model_compute_object( self, data );
+}
+#endif /* PY_VERSION_HEX */
+
+/* The kernel of the engine ( capped by LIBSCRC_KERNEL ), the same dispatch as libscrc.kernel_for(). */
+static const char *hexin_model_kernel( const hexin_model *self )
+{
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        return hexin_cpu_kernel_name( hexin_crc32_compute_kernel( &self->param.crc32 ) );
+    }
+    return hexin_cpu_kernel_name( hexin_crc64_compute_kernel( &self->param.crc64 ) );
+}
+
+static PyObject * hexin_model_new( PyTypeObject *type, PyObject *args, PyObject *kws )
+{
+    hexin_model *self = NULL;
+    unsigned int width = 0, refin = FALSE, refout = FALSE;
+    unsigned long long poly = 0, init = 0, xorout = 0, mask = 0;
+    static char* kwlist[]={ "width", "poly", "init", "refin", "refout", "xorout", NULL };
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "IK|KppK", kwlist, &width, &poly, &init, &refin, &refout, &xorout ) ) {
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "IK|KIIK", kwlist, &width, &poly, &init, &refin, &refout, &xorout ) ) {
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( ( width < HEXIN_MODEL_MIN_WIDTH ) || ( width > HEXIN_MODEL_MAX_WIDTH ) ) {
+        PyErr_Format( PyExc_ValueError, "width must be %d .. %d, not %u", HEXIN_MODEL_MIN_WIDTH, HEXIN_MODEL_MAX_WIDTH, width );
+        return NULL;
+    }
+    mask = ( unsigned long long )( ~( unsigned long long )0 ) >> ( 64 - width );
+    if ( ( poly & ~mask ) || ( init & ~mask ) || ( xorout & ~mask ) ) {
+        PyErr_Format( PyExc_ValueError, "poly, init and xorout must fit in %u bits", width );
+        return NULL;
+    }
+
+    self = ( hexin_model * )type->tp_alloc( type, 0 );
+    if ( self == NULL ) {
+        return NULL;
+    }
+#if PY_VERSION_HEX >= 0x03090000
+    self->vectorcall = hexin_model_vectorcall;
+#endif /* PY_VERSION_HEX */
+    self->engine  = ( width > HEXIN_CRC32_WIDTH ) ? HEXIN_MODEL_ENGINE_CRC64 : HEXIN_MODEL_ENGINE_CRC32;
+    self->width   = width;
+    self->poly    = poly;
+    self->init    = init;
+    self->xorout  = xorout;
+    self->refin   = refin  ? TRUE : FALSE;
+    self->refout  = refout ? TRUE : FALSE;
+    self->combine = NULL;
+    self->tables  = PyMem_Malloc( sizeof( *self->tables ) );
+    if ( self->tables == NULL ) {
+        Py_DECREF( self );
+        return PyErr_NoMemory();
+    }
+
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        self->param.crc32.is_initial = FALSE;
+        self->param.crc32.width      = width;
+        self->param.crc32.poly       = ( unsigned int )poly;
+        self->param.crc32.init       = ( unsigned int )init;
+        self->param.crc32.refin      = self->refin;
+        self->param.crc32.refout     = self->refout;
+        self->param.crc32.xorout     = ( unsigned int )xorout;
+        hexin_crc32_compute_init( &self->param.crc32, &self->tables->crc32 );
+    } else {
+        self->param.crc64.is_initial = FALSE;
+        self->param.crc64.width      = width;
+        self->param.crc64.poly       = poly;
+        self->param.crc64.init       = init;
+        self->param.crc64.refin      = self->refin;
+        self->param.crc64.refout     = self->refout;
+        self->param.crc64.xorout     = xorout;
+        hexin_crc64_compute_init( &self->param.crc64, &self->tables->crc64 );
+    }
+    self->kernel = hexin_model_kernel( self );
+    return ( PyObject * )self;
+}
+
+static void hexin_model_dealloc( hexin_model *self )
+{
+    PyMem_Free( self->tables );
+    PyMem_Free( self->combine );
+    Py_TYPE( self )->tp_free( ( PyObject * )self );
+}
+
+/*
+ * Incremental ( hashlib style ) objects of Model.new(), as the ones of libscrc.new().
+ * The object holds a reference to its model and computes with its descriptor and tables.
+ * lock serializes update() / digest() / copy() of threads sharing an object, once an update() released the GIL ( _hexin_lock.h ).
+ */
+typedef struct {
+    PyObject_HEAD
+    hexin_model        *model;
+    unsigned long long  crc;
+    PyThread_type_lock  lock;
+} hexin_model_hash;
+
+static PyTypeObject hexin_model_hash_type = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+
+static hexin_model_hash *hexin_model_hash_alloc( hexin_model *model, unsigned long long crc )
+{
+    hexin_model_hash *self = PyObject_New( hexin_model_hash, &hexin_model_hash_type );
+
+    if ( self == NULL ) {
+        return NULL;
+    }
+    Py_INCREF( model );
+    self->model = model;
+    self->crc   = crc;
+    self->lock  = NULL;
+    return self;
+}
+
+static void hexin_model_hash_dealloc( hexin_model_hash *self )
+{
+    Py_DECREF( self->model );
+    hexin_lock_free( self->lock );
+    PyObject_Del( self );
+}
+
+static unsigned char hexin_model_hash_update_object( hexin_model_hash *self, PyObject *object )
+{
+    Py_buffer data = { NULL, NULL };
+
+    if ( PyObject_GetBuffer( object, &data, PyBUF_SIMPLE ) < 0 ) {
+        return FALSE;
+    }
+
+    if ( ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) && !hexin_lock_prepare( &self->lock ) ) {
+        PyBuffer_Release( &data );
+        return FALSE;
+    }
+
+    hexin_lock_acquire( self->lock );
+    if ( data.len >= HEXIN_GIL_RELEASE_MINSIZE ) {
+        Py_BEGIN_ALLOW_THREADS
+        self->crc = hexin_model_update( self->model, (const unsigned char *)data.buf, (size_t)data.len, self->crc );
+        Py_END_ALLOW_THREADS
+    } else {
+        self->crc = hexin_model_update( self->model, (const unsigned char *)data.buf, (size_t)data.len, self->crc );
+    }
+    hexin_lock_release( self->lock );
+
+    PyBuffer_Release( &data );
+    return TRUE;
+}
+
+/* The register, once an update() of another thread is done. */
+static unsigned long long hexin_model_hash_crc( hexin_model_hash *self )
+{
+    unsigned long long crc = 0;
+
+    hexin_lock_acquire( self->lock );
+    crc = self->crc;
+    hexin_lock_release( self->lock );
+    return crc;
+}
+
+static Py_ssize_t hexin_model_hash_size( hexin_model_hash *self )
+{
+    return ( Py_ssize_t )( ( self->model->width + 7 ) / 8 );
+}
+
+static PyObject * hexin_model_hash_update( hexin_model_hash *self, PyObject *args )
+{
+    PyObject *data = NULL;
+
+    if ( !PyArg_ParseTuple( args, "O", &data ) ) {
+        return NULL;
+    }
+    if ( !hexin_model_hash_update_object( self, data ) ) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject * hexin_model_hash_digest( hexin_model_hash *self, PyObject *unused )
+{
+    unsigned char digest[8] = { 0 };
+    unsigned long long value = hexin_model_final( self->model, hexin_model_hash_crc( self ) );
+    Py_ssize_t i = 0, size = hexin_model_hash_size( self );
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = ( unsigned char )( value & 0xFF );
+        value >>= 8;
+    }
+    return PyBytes_FromStringAndSize( ( const char * )digest, size );
+}
+
+static PyObject * hexin_model_hash_hexdigest( hexin_model_hash *self, PyObject *unused )
+{
+    static const char hex[] = "0123456789abcdef";
+    char digest[16] = { 0 };
+    unsigned long long value = hexin_model_final( self->model, hexin_model_hash_crc( self ) );
+    Py_ssize_t i = 0, size = hexin_model_hash_size( self ) * 2;
+
+    for ( i=size-1; i>=0; i-- ) {
+        digest[i] = hex[ value & 0x0F ];
+        value >>= 4;
+    }
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromStringAndSize( digest, size );
+#else
+    return PyString_FromStringAndSize( digest, size );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * hexin_model_hash_intdigest( hexin_model_hash *self, PyObject *unused )
+{
+    return PyLong_FromUnsignedLongLong( hexin_model_final( self->model, hexin_model_hash_crc( self ) ) );
+}
+
+static PyObject * hexin_model_hash_copy( hexin_model_hash *self, PyObject *unused )
+{
+    return ( PyObject * )hexin_model_hash_alloc( self->model, hexin_model_hash_crc( self ) );
+}
+
+static PyObject * hexin_model_hash_get_name( hexin_model_hash *self, void *closure )
+{
+    return Py_BuildValue( "s", "model" );
+}
+
+static PyObject * hexin_model_hash_get_digest_size( hexin_model_hash *self, void *closure )
+{
+    return Py_BuildValue( "n", hexin_model_hash_size( self ) );
+}
+
+static PyObject * hexin_model_hash_get_model( hexin_model_hash *self, void *closure )
+{
+    Py_INCREF( self->model );
+    return ( PyObject * )self->model;
+}
+
+static PyMethodDef hexin_model_hash_methods[] = {
+    { "update",    (PyCFunction)hexin_model_hash_update,    METH_VARARGS, "Update the CRC with the bytes of data" },
+    { "digest",    (PyCFunction)hexin_model_hash_digest,    METH_NOARGS,  "CRC of the data passed so far, as big-endian bytes" },
+    { "hexdigest", (PyCFunction)hexin_model_hash_hexdigest, METH_NOARGS,  "Like digest(), as a string of hexadecimal digits" },
+    { "intdigest", (PyCFunction)hexin_model_hash_intdigest, METH_NOARGS,  "Like digest(), as the integer the model returns" },
+    { "copy",      (PyCFunction)hexin_model_hash_copy,      METH_NOARGS,  "Copy of the object, to share the CRC of a common prefix" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_model_hash_getset[] = {
+    { "name",        (getter)hexin_model_hash_get_name,        NULL, "Name of the CRC model", NULL },
+    { "digest_size", (getter)hexin_model_hash_get_digest_size, NULL, "Size of digest() in bytes", NULL },
+    { "model",       (getter)hexin_model_hash_get_model,       NULL, "The libscrc.Model of the object", NULL },
+    { NULL, NULL, NULL, NULL, NULL }    /* Sentinel */
+};
+
+static PyObject * hexin_model_new_hash( hexin_model *self, HEXIN_FASTCALL_ARGS )
+{
+    hexin_model_hash *hash = NULL;
+    static const char* kwlist[]={ "data", NULL };
+    PyObject *values[1];
+
+    if ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 0, values ) < 0 ) {
+        return NULL;
+    }
+
+    hash = hexin_model_hash_alloc( self, hexin_model_start( self ) );
+    if ( hash == NULL ) {
+        return NULL;
+    }
+
+    if ( ( values[0] != NULL ) && ( values[0] != Py_None ) && !hexin_model_hash_update_object( hash, values[0] ) ) {
+        Py_DECREF( hash );
+        return NULL;
+    }
+    return ( PyObject * )hash;
+}
+
+static PyObject * hexin_model_combine( hexin_model *self, HEXIN_FASTCALL_ARGS )
+{
+    unsigned long long crc1 = 0, crc2 = 0, len2 = 0, result = 0;
+    static const char* kwlist[]={ "crc1", "crc2", "len2", NULL };
+    PyObject *values[3];
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 3, values ) < 0 ) ||
+         !hexin_fastcall_unsigned( values[0], &crc1 ) ||
+         !hexin_fastcall_unsigned( values[1], &crc2 ) ||
+         !hexin_fastcall_unsigned( values[2], &len2 ) ) {
+        return NULL;
+    }
+
+    /* The power-of-two operators are built once, the GIL protects them. */
+    if ( self->combine == NULL ) {
+        self->combine = PyMem_Malloc( sizeof( *self->combine ) );
+        if ( self->combine == NULL ) {
+            return PyErr_NoMemory();
+        }
+        if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+            hexin_crc32_combine_init( &self->param.crc32, &self->combine->crc32 );
+        } else {
+            hexin_crc64_combine_init( &self->param.crc64, &self->combine->crc64 );
+        }
+    }
+
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        result = hexin_crc32_combine( &self->combine->crc32, ( unsigned int )crc1, ( unsigned int )crc2, len2 );
+    } else {
+        result = hexin_crc64_combine( &self->combine->crc64, crc1, crc2, len2 );
+    }
+    return PyLong_FromUnsignedLongLong( result & hexin_model_mask( self ) );
+}
+
+static void hexin_model_batch_compute( const hexin_model *self, const struct _hexin_batch *batch, void *crc )
+{
+    if ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) {
+        hexin_crc32_compute_multi( batch->pSrc, batch->len, ( size_t )batch->count, &self->param.crc32, ( unsigned int * )crc );
+    } else {
+        hexin_crc64_compute_multi( batch->pSrc, batch->len, ( size_t )batch->count, &self->param.crc64, ( unsigned long long * )crc );
+    }
+}
+
+static PyObject * hexin_model_batch( hexin_model *self, HEXIN_FASTCALL_ARGS )
+{
+    PyObject *crc = NULL, *result = NULL;
+    struct _hexin_batch batch;
+    size_t size = ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) ? sizeof( unsigned int ) : sizeof( unsigned long long );
+    static const char* kwlist[]={ "data", "offsets", NULL };
+    PyObject *values[2];
+
+    if ( hexin_fastcall_parse( HEXIN_FASTCALL_PASS, kwlist, 1, values ) < 0 ) {
+        return NULL;
+    }
+
+    if ( !hexin_batch_acquire( &batch, values[0], values[1] ) ) {
+        return NULL;
+    }
+
+    /* Results in native byte order, wrapped in an array.array as libscrc.batch() does. */
+    crc = PyBytes_FromStringAndSize( NULL, ( Py_ssize_t )size * batch.count );
+    if ( crc != NULL ) {
+        if ( batch.total >= HEXIN_GIL_RELEASE_MINSIZE ) {
+            Py_BEGIN_ALLOW_THREADS
+            hexin_model_batch_compute( self, &batch, PyBytes_AS_STRING( crc ) );
+            Py_END_ALLOW_THREADS
+        } else {
+            hexin_model_batch_compute( self, &batch, PyBytes_AS_STRING( crc ) );
+        }
+        result = PyObject_CallFunction( hexin_model_array, "sO", ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) ? "I" : "Q", crc );
+        Py_DECREF( crc );
+    }
+
+    hexin_batch_release( &batch );
+    return result;
+}
+
+static PyObject * hexin_model_repr( hexin_model *self )
+{
+    char repr[160];
+
+    PyOS_snprintf( repr, sizeof( repr ), "libscrc.Model(width=%u, poly=0x%llX, init=0x%llX, refin=%s, refout=%s, xorout=0x%llX)",
+                   self->width, self->poly, self->init, self->refin ? "True" : "False", self->refout ? "True" : "False", self->xorout );
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromString( repr );
+#else
+    return PyString_FromString( repr );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * hexin_model_get_refin( hexin_model *self, void *closure )
+{
+    return PyBool_FromLong( self->refin );
+}
+
+static PyObject * hexin_model_get_refout( hexin_model *self, void *closure )
+{
+    return PyBool_FromLong( self->refout );
+}
+
+static PyObject * hexin_model_get_engine( hexin_model *self, void *closure )
+{
+    return Py_BuildValue( "s", ( self->engine == HEXIN_MODEL_ENGINE_CRC32 ) ? "crc32" : "crc64" );
+}
+
+static PyObject * hexin_model_get_kernel( hexin_model *self, void *closure )
+{
+    return Py_BuildValue( "s", self->kernel );
+}
+
+static PyMethodDef hexin_model_methods[] = {
+    { "new",     (PyCFunction)hexin_model_new_hash, HEXIN_METH_FASTCALL_KEYWORDS, "Incremental object of the model, like libscrc.new(). model.new( data=None )" },
+    { "combine", (PyCFunction)hexin_model_combine,  HEXIN_METH_FASTCALL_KEYWORDS, "CRC of A + B from CRC( A ), CRC( B ) and len( B ). model.combine( crc1, crc2, len2 )" },
+    { "batch",   (PyCFunction)hexin_model_batch,    HEXIN_METH_FASTCALL_KEYWORDS, "CRC of many frames in one call, like libscrc.batch(). model.batch( data, offsets=None )" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyMemberDef hexin_model_members[] = {
+    { "width",  T_UINT,      offsetof( hexin_model, width  ), READONLY, "Width of the CRC in bits" },
+    { "poly",   T_ULONGLONG, offsetof( hexin_model, poly   ), READONLY, "Polynomial, MSB first without the x^width term" },
+    { "init",   T_ULONGLONG, offsetof( hexin_model, init   ), READONLY, "Initial value of the register" },
+    { "xorout", T_ULONGLONG, offsetof( hexin_model, xorout ), READONLY, "Value XORed to the final register" },
+    { NULL, 0, 0, 0, NULL }    /* Sentinel */
+};
+
+static PyGetSetDef hexin_model_getset[] = {
+    { "refin",  (getter)hexin_model_get_refin,  NULL, "Input bytes reflected", NULL },
+    { "refout", (getter)hexin_model_get_refout, NULL, "Result reflected", NULL },
+    { "engine", (getter)hexin_model_get_engine, NULL, "Engine of the model, crc32 ( width <= 32 ) or crc64", NULL },
+    { "kernel", (getter)hexin_model_get_kernel, NULL, "Kernel of the large buffers on this CPU ( capped by LIBSCRC_KERNEL ), one of libscrc.KERNELS", NULL },
+    { NULL, NULL, NULL, NULL, NULL }    /* Sentinel */
+};
+
+PyDoc_STRVAR( hexin_model_doc,
+"Model( width, poly, init=0, refin=False, refout=False, xorout=0 )\n"
+"A CRC model of 3 .. 64 bits compiled once, its tables and folding constants are built by the constructor.\n"
+"crc = libscrc.Model( 16, 0x1021, init=0xFFFF )\n"
+"crc( b'123456789' ) == libscrc.ccitt_false( b'123456789' )\n"
+"crc.new(), crc.combine() and crc.batch() are the ones of libscrc.new(), libscrc.combine() and libscrc.batch()." );
+
+static int hexin_model_type_ready( void )
+{
+    PyObject *array = NULL;
+
+    hexin_model_type.tp_name      = "libscrc.Model";
+    hexin_model_type.tp_basicsize = sizeof( hexin_model );
+    hexin_model_type.tp_dealloc   = ( destructor )hexin_model_dealloc;
+    hexin_model_type.tp_repr      = ( reprfunc )hexin_model_repr;
+    hexin_model_type.tp_flags     = Py_TPFLAGS_DEFAULT;
+    hexin_model_type.tp_doc       = hexin_model_doc;
+    hexin_model_type.tp_methods   = hexin_model_methods;
+    hexin_model_type.tp_members   = hexin_model_members;
+    hexin_model_type.tp_getset    = hexin_model_getset;
+    hexin_model_type.tp_new       = hexin_model_new;
+#if PY_VERSION_HEX >= 0x03090000
+    hexin_model_type.tp_flags    |= Py_TPFLAGS_HAVE_VECTORCALL;
+    hexin_model_type.tp_call      = PyVectorcall_Call;
+    hexin_model_type.tp_vectorcall_offset = offsetof( hexin_model, vectorcall );
+#else
+    hexin_model_type.tp_call      = ( ternaryfunc )hexin_model_call;
+#endif /* PY_VERSION_HEX */
+    if ( PyType_Ready( &hexin_model_type ) < 0 ) {
+        return -1;
+    }
+
+    hexin_model_hash_type.tp_name      = "libscrc._model.model_hash";
+    hexin_model_hash_type.tp_basicsize = sizeof( hexin_model_hash );
+    hexin_model_hash_type.tp_dealloc   = ( destructor )hexin_model_hash_dealloc;
+    hexin_model_hash_type.tp_flags     = Py_TPFLAGS_DEFAULT;
+    hexin_model_hash_type.tp_doc       = "Incremental object of a libscrc.Model, see Model.new()";
+    hexin_model_hash_type.tp_methods   = hexin_model_hash_methods;
+    hexin_model_hash_type.tp_getset    = hexin_model_hash_getset;
+    if ( PyType_Ready( &hexin_model_hash_type ) < 0 ) {
+        return -1;
+    }
+
+    array = PyImport_ImportModule( "array" );
+    if ( array == NULL ) {
+        return -1;
+    }
+    hexin_model_array = PyObject_GetAttrString( array, "array" );
+    Py_DECREF( array );
+    return ( hexin_model_array == NULL ) ? -1 : 0;
+}
+
+/* method table */
+static PyMethodDef _modelMethods[] = {
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+/* module documentation */
+PyDoc_STRVAR( _model_doc,
+"CRC models compiled once\n"
+"libscrc.Model      -> Model( width, poly, init=0, refin=False, refout=False, xorout=0 ), any width from 3 to 64\n"
+"\n" );
+
+
+#if PY_MAJOR_VERSION >= 3
+
+/* module definition structure */
+static struct PyModuleDef _modelmodule = {
+   PyModuleDef_HEAD_INIT,
+   "_model",                    /* name of module */
+   _model_doc,                  /* module documentation, may be NULL */
+   -1,                          /* size of per-interpreter state of the module */
+   _modelMethods
+};
+
+/* initialization function for Python 3 */
+PyMODINIT_FUNC
+PyInit__model( void )
+{
+    PyObject *m;
+
+    if ( hexin_model_type_ready() < 0 ) {
+        return NULL;
+    }
+
+    /* Probe the CPU at import, the models may compute without the GIL. */
+    hexin_clmul_is_supported();
+    hexin_crc32c_hw_is_supported();
+
+    /* The engine of crc32 / crc64 calls the worker pool of libscrc._pool. */
+    if ( !hexin_pool_import() ) {
+        return NULL;
+    }
+
+    m = PyModule_Create( &_modelmodule );
+    if ( m == NULL ) {
+        return NULL;
+    }
+
+    Py_INCREF( &hexin_model_type );
+    PyModule_AddObject( m, "Model", ( PyObject * )&hexin_model_type );
+    PyModule_AddStringConstant( m, "__version__", "1.8"  );
+    PyModule_AddStringConstant( m, "__author__",  "Heyn" );
+
+    return m;
+}
+
+#else
+
+/* initialization function for Python 2 */
+PyMODINIT_FUNC
+init_model( void )
+{
+    PyObject *m;
+
+    if ( hexin_model_type_ready() < 0 ) {
+        return;
+    }
+    /* Probe the CPU at import, the models may compute without the GIL. */
+    hexin_clmul_is_supported();
+    hexin_crc32c_hw_is_supported();
+    if ( !hexin_pool_import() ) {
+        return;
+    }
+    m = Py_InitModule3( "_model", _modelMethods, _model_doc );
+    if ( m == NULL ) {
+        return;
+    }
+    Py_INCREF( &hexin_model_type );
+    PyModule_AddObject( m, "Model", ( PyObject * )&hexin_model_type );
+}
+
+#endif /* PY_MAJOR_VERSION */
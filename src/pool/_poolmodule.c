@@ -0,0 +1,94 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2022-2022, Hexin
+*                                           All Rights Reserved
+* File    : _poolmodule.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.8
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2022-06-15 [Heyn] Initialize.
+*                       The worker pool of the threads=N calls ( src/common/_hexin_pool.c ), one per process.
+*                       Every extension used to link its own copy, up to 8 pools with their own lock and workers.
+*                       The others get it from the capsule libscrc._pool._C_API ( hexin_pool_import ).
+*                       2022-06-15 [Heyn] The pool is reset in the child of a fork() ( hexin_pool_init ).
+*
+*********************************************************************************************************
+*/
+
+#include <Python.h>
+#include "_hexin_pool.h"
+
+static const struct _hexin_pool_api hexin_pool_api = { hexin_pool_run };
+
+/* method table */
+static PyMethodDef _poolMethods[] = {
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+/* module documentation */
+PyDoc_STRVAR( _pool_doc,
+"Worker pool of the threads=N calls, shared by the libscrc extensions \n"
+"Author : Heyn \n"
+"\n" );
+
+#if PY_MAJOR_VERSION >= 3
+
+/* module definition structure */
+static struct PyModuleDef _poolmodule = {
+   PyModuleDef_HEAD_INIT,
+   "_pool",                     /* name of module */
+   _pool_doc,                   /* module documentation, may be NULL */
+   -1,                          /* size of per-interpreter state of the module */
+   _poolMethods
+};
+
+/* initialization function for Python 3 */
+PyMODINIT_FUNC
+PyInit__pool( void )
+{
+    PyObject *m, *capsule;
+
+    if ( !hexin_pool_init() ) {
+        PyErr_SetString( PyExc_RuntimeError, "can not register the fork() handler of the worker pool" );
+        return NULL;
+    }
+
+    m = PyModule_Create( &_poolmodule );
+    if ( m == NULL ) {
+        return NULL;
+    }
+
+    capsule = PyCapsule_New( ( void * )&hexin_pool_api, HEXIN_POOL_CAPSULE, NULL );
+    if ( ( capsule == NULL ) || ( PyModule_AddObject( m, "_C_API", capsule ) < 0 ) ) {
+        Py_XDECREF( capsule );
+        Py_DECREF( m );
+        return NULL;
+    }
+    PyModule_AddStringConstant( m, "__version__", "1.8"  );
+    PyModule_AddStringConstant( m, "__author__",  "Heyn" );
+
+    return m;
+}
+
+#else
+
+/* initialization function for Python 2 */
+PyMODINIT_FUNC
+init_pool( void )
+{
+    PyObject *m;
+
+    if ( !hexin_pool_init() ) {
+        PyErr_SetString( PyExc_RuntimeError, "can not register the fork() handler of the worker pool" );
+        return;
+    }
+    m = Py_InitModule3( "_pool", _poolMethods, _pool_doc );
+    if ( m == NULL ) {
+        return;
+    }
+    PyModule_AddObject( m, "_C_API", PyCapsule_New( ( void * )&hexin_pool_api, HEXIN_POOL_CAPSULE, NULL ) );
+}
+
+#endif /* PY_MAJOR_VERSION */